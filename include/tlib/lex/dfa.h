@@ -27,6 +27,8 @@
 
 
 #include "exp.h"
+#include <algorithm>
+#include <vector>
 
 namespace tlib
 {
@@ -56,6 +58,128 @@ struct Dfa
 	unsigned int total_states;
 };
 
+/* The position automaton of the expression, a DFA state is a set of
+ * its positions. */
+template <class T>
+struct Nfa
+{
+	typedef std::vector<Range<T> > RangeVector;
+	// The split ranges, range i is the input i.
+	RangeVector range_map;
+	// Action of every position.
+	std::vector<Action> actions;
+	// Follow positions of position i are follows[follow_begin[i]] to
+	// follows[follow_begin[i + 1] - 1].
+	std::vector<unsigned int> follow_begin;
+	std::vector<unsigned int> follows;
+	// Position i reads the inputs from cover_begin[i] to cover_end[i] - 1.
+	std::vector<unsigned int> cover_begin;
+	std::vector<unsigned int> cover_end;
+	// Sorted positions of the start state.
+	std::vector<unsigned int> first;
+	// The <EOF> position, a state that has it is accepting.
+	unsigned int finished_id;
+};
+
+/* The position sets of the DFA states, every set is a sorted array in
+ * "positions", the sets are found by hash. */
+class StateSets
+{
+public:
+	inline StateSets()
+	: _buckets(64, 0)
+	{
+		_begin.push_back(0);
+	}
+
+	inline unsigned int size() const
+	{
+		return (unsigned int)_begin.size() - 1;
+	}
+
+	inline const unsigned int* begin(unsigned int id) const
+	{
+		return &_positions[0] + _begin[id];
+	}
+
+	inline const unsigned int* end(unsigned int id) const
+	{
+		return &_positions[0] + _begin[id + 1];
+	}
+
+	/* Count of the positions of all sets. */
+	inline unsigned int positions() const
+	{
+		return (unsigned int)_positions.size();
+	}
+
+	/* Return the id of the set, add it if not exists. */
+	unsigned int find_or_add(const std::vector<unsigned int>& set)
+	{
+		unsigned int hash = hash_set(set);
+		unsigned int mask = (unsigned int)_buckets.size() - 1;
+		unsigned int i = hash & mask;
+		while (_buckets[i] != 0)
+		{
+			unsigned int id = _buckets[i] - 1;
+			if (_hashes[id] == hash
+					&& _begin[id + 1] - _begin[id] == set.size()
+					&& std::equal(set.begin(), set.end(), begin(id)))
+				return id;
+			i = (i + 1) & mask;
+		}
+		unsigned int id = size();
+		_positions.insert(_positions.end(), set.begin(), set.end());
+		_begin.push_back((unsigned int)_positions.size());
+		_hashes.push_back(hash);
+		_buckets[i] = id + 1;
+		if (size() * 2 > _buckets.size())
+			rehash();
+		return id;
+	}
+
+	/* Remove all sets. */
+	void clear()
+	{
+		_positions.clear();
+		_begin.assign(1, 0);
+		_hashes.clear();
+		_buckets.assign(64, 0);
+	}
+
+private:
+	static unsigned int hash_set(const std::vector<unsigned int>& set)
+	{
+		unsigned int hash = 2166136261U;
+		for (unsigned int i = 0; i < set.size(); i++)
+			hash = (hash ^ set[i]) * 16777619U;
+		return hash;
+	}
+
+	void rehash()
+	{
+		_buckets.assign(_buckets.size() * 2, 0);
+		unsigned int mask = (unsigned int)_buckets.size() - 1;
+		for (unsigned int id = 0; id < size(); id++)
+		{
+			unsigned int i = _hashes[id] & mask;
+			while (_buckets[i] != 0)
+				i = (i + 1) & mask;
+			_buckets[i] = id + 1;
+		}
+	}
+
+	std::vector<unsigned int> _positions;
+	std::vector<unsigned int> _begin;
+	std::vector<unsigned int> _hashes;
+	// State id + 1, 0 means an empty bucket.
+	std::vector<unsigned int> _buckets;
+};
+
+/* Compute the positions, their follows and the inputs they read. */
+template <class T>
+void make_nfa(typename Exp<T>::ExpPtr exp, Nfa<T>& nfa);
+
 /* Compute the expression's node values.  */
 template <class T>
 void make_dfa(typename Exp<T>::ExpPtr exp, Dfa<T>& dfa);
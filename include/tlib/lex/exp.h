@@ -28,7 +28,7 @@
 
 #include "scan.h"
 #include <stdexcept>
-#include <memory>
+#include <vector>
 
 namespace tlib
 {
@@ -53,7 +53,9 @@ template <class T>
 class Exp
 {
 public:
-	typedef std::shared_ptr<Exp<T> > ExpPtr;
+	// The nodes are owned by an ExpPool.
+	typedef Exp<T>* ExpPtr;
+	Exp();
 	Exp(const Range<T>& r);
 	Exp(NodeType t, ExpPtr c);
 	Exp(NodeType t, ExpPtr l, ExpPtr r);
@@ -71,12 +73,37 @@ public:
 	ExpPtr child;
 
 	bool nullable;
-	std::vector<unsigned int> firstpos;
-	std::vector<unsigned int> lastpos;
+	// Handles of the position sets built by make_dfa(), 0 is empty.
+	unsigned int firstpos;
+	unsigned int lastpos;
 public:
 	Action action;
 };
 
+// Count of the nodes that an ExpPool allocates at once.
+#define EXP_POOL_BLOCK 256
+
+/* Allocate the nodes of the expressions by blocks, all of them are freed
+ * when the pool is destroyed. */
+template <class T>
+class ExpPool
+{
+public:
+	ExpPool();
+	~ExpPool();
+	typename Exp<T>::ExpPtr create(const Range<T>& r);
+	typename Exp<T>::ExpPtr create(NodeType t, typename Exp<T>::ExpPtr c);
+	typename Exp<T>::ExpPtr create(NodeType t, typename Exp<T>::ExpPtr l,
+			typename Exp<T>::ExpPtr r);
+private:
+	ExpPool(const ExpPool&);
+	ExpPool& operator = (const ExpPool&);
+	inline typename Exp<T>::ExpPtr alloc();
+	std::vector<Exp<T>*> _blocks;
+	// Nodes used in the last block.
+	unsigned int _used;
+};
+
 typedef enum _JoinType
 {
 	RE_JOIN_AND = 0,
@@ -84,7 +111,8 @@ typedef enum _JoinType
 } JoinType;
 
 template <class T> inline
-typename Exp<T>::ExpPtr exp_join(typename Exp<T>::ExpPtr l, typename Exp<T>::ExpPtr r, JoinType type);
+typename Exp<T>::ExpPtr exp_join(ExpPool<T>& pool, typename Exp<T>::ExpPtr l,
+		typename Exp<T>::ExpPtr r, JoinType type);
 
 typedef enum _PackType
 {
@@ -94,11 +122,18 @@ typedef enum _PackType
 } PackType;
 
 template <class T> inline
-typename Exp<T>::ExpPtr exp_package(typename Exp<T>::ExpPtr c, PackType type);
+typename Exp<T>::ExpPtr exp_package(ExpPool<T>& pool, typename Exp<T>::ExpPtr c, PackType type);
 
 /* Create a new regular expression that parse from a string.*/
 template <class T>
-typename Exp<T>::ExpPtr exp_parse(const T* expression) throw (std::runtime_error);
+typename Exp<T>::ExpPtr exp_parse(ExpPool<T>& pool, const T* expression)
+		throw (std::runtime_error);
+
+/* Convert an expression of Unicode code points to the expression that
+ * matches the same text encoded in UTF-8, T is char or unsigned char. */
+template <class T>
+typename Exp<T>::ExpPtr exp_utf8(ExpPool<T>& pool, Exp<wchar_t>::ExpPtr exp)
+		throw (std::runtime_error);
 
 /* Do a depth-first traversing */
 
@@ -109,18 +144,19 @@ void exp_depth_travel(typename Exp<T>::ExpPtr exp,
 
 
 template <class T> inline
-typename Exp<T>::ExpPtr exp_join(typename Exp<T>::ExpPtr l, typename Exp<T>::ExpPtr r, JoinType type)
+typename Exp<T>::ExpPtr exp_join(ExpPool<T>& pool, typename Exp<T>::ExpPtr l,
+		typename Exp<T>::ExpPtr r, JoinType type)
 {
-	return typename Exp<T>::ExpPtr(new Exp<T>((type == RE_JOIN_AND ? RE_NODE_AND : RE_NODE_OR), l, r));
+	return pool.create((type == RE_JOIN_AND ? RE_NODE_AND : RE_NODE_OR), l, r);
 }
 
 
 template <class T> inline
-typename Exp<T>::ExpPtr exp_package(typename Exp<T>::ExpPtr c, PackType type)
+typename Exp<T>::ExpPtr exp_package(ExpPool<T>& pool, typename Exp<T>::ExpPtr c, PackType type)
 {
 	static const NodeType pack[RE_PACK_0_1 + 1] =
 	{ RE_NODE_CLOSURE, RE_NODE_PLUS, RE_NODE_QUESTION };
-	return typename Exp<T>::ExpPtr(new Exp<T>(pack[type], c));
+	return pool.create(pack[type], c);
 }
 
 
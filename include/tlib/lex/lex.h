@@ -112,6 +112,124 @@ int main()
 
 *************************************************************************
 * End of example.
+*************************************************************************
+
+* Parse a memory buffer:
+
+	When the input is a memory buffer, call parse(buffer, length), the
+	lexical will scan the buffer directly and the token's "data" member
+	point to the token text inside of the buffer, so the "str" member
+	will not be filled, use get_str() to get a copy of the token text.
+	Caller must keep the buffer valid until the parsing is finished.
+	The "name" member always point to the action name inside of the
+	lexer, use get_name() to get a copy of it. Positions and lengths
+	are size_t so a buffer can be bigger than 4 GB, but "line" and
+	"line_pos" are 32 bits.
+
+		std::string text = "...";
+		lexical->parse(text.c_str(), text.length());
+		lex::Token<char> token;
+		while (lexical->fetch_next(token))
+		{
+			cout << token.name << ": " << token.get_str() << endl;
+		}
+
+* Fetch tokens in batch:
+
+	next_tokens() fetch many tokens at once into a TokenBatch, every field
+	of the tokens is stored in a separated array and the ignored tokens
+	have been skipped, no token text is copied, so it should be used with
+	a memory buffer.
+
+		lex::TokenBatch batch;
+		lexical->parse(text.c_str(), text.length());
+		while (lexical->next_tokens(batch, 64))
+		{
+			for (size_t i = 0; i < batch.size(); i++)
+				cout << batch.action[i] << ": "
+					<< text.substr(batch.pos[i], batch.length[i]) << endl;
+		}
+
+* Share a lexer between threads:
+
+	A Lexical owns its compiled tables. To load the tables once and use
+	them in many threads, create a CompiledLexer and give every thread
+	its own Scanner, a scanner only keeps the position and it is cheap
+	to create.
+
+		lex::CompiledLexer<char>::CompiledLexerPtr lexer =
+				lex::CompiledLexer<char>::create_by_file("test.lex");
+		// In every thread:
+		lex::Scanner<char> scanner(lexer);
+		scanner.parse(text.c_str(), text.length());
+		lex::Token<char> token;
+		while (scanner.fetch_next(token))
+			...
+
+* Fetch tokens by many threads:
+
+	tokenize() splits a big buffer into chunks and scans every chunk on
+	its own thread. A chunk is scanned as if a token begins at its start,
+	when the previous chunk reaches a token that the chunk also found,
+	the rest tokens of the chunk are taken, otherwise the tokens are
+	scanned again until they meet. Lexical of a common language meets
+	in a few tokens, so the result is the same as next_tokens() and the
+	speed grows with the count of processors.
+
+		lex::TokenBatch batch;
+		lexical->tokenize(text.c_str(), text.length(), batch);
+
+* Cache the compiled lexicals:
+
+	Compiling a big definition takes a while, a short-lived program can
+	keep the result in a cache directory. create() and create_utf8()
+	(and their file versions) look for the byte code under the MD5 of
+	the definition and the character type, the found file is mapped
+	into memory instead of being compiled again.
+
+		lex::set_lexical_cache(get_home_path() + "/.cache/tlib");
+		lexical = lex::Lexical<char>::create_by_file("test.lex");
+
+* Precompile a fixed regex:
+
+	A pattern known at build time needn't be compiled at run time. Put
+	it in a definition file, compile it by lexgen and embed the byte
+	code by mkres, the table is constant data of the program and the
+	regex only validates it (see src/xml/gen/Makefile).
+
+		lexgen -o quote.bc quote.lex
+		mkres --name quote_bc quote.bc > quote_bc.cpp
+
+		extern const unsigned char quote_bc[];
+		extern const unsigned int quote_bc_length;
+		lex::Regex<char> regex(quote_bc, quote_bc_length, true);
+
+* Scan by a lazy DFA:
+
+	Some definitions (e.g. many rules begin with ".*") have too many DFA
+	states to build them all. create_lazy() only computes the positions
+	of the expressions, every scanner builds the states it meets into a
+	cache of limited size, which is dropped and filled again when it is
+	full. The tokens are the same as the normal lexical, the hot states
+	are scanned as fast, tokenize() uses only one thread then.
+
+		lexical = lex::Lexical<char>::create_lazy(definition, 1 << 20);
+		lex::Regex<char> regex(std::string("(a|b)*a(a|b)(a|b)(a|b)"), 1 << 20);
+
+* Profile a lexical:
+
+	Build the library with TLIB_LEX_PROFILE defined, then every scanner
+	counts the tokens of every action, the characters read beyond the
+	end of the tokens and the visits of every DFA state. The counters
+	cost nothing when the macro is not defined, profile() is always
+	empty then.
+
+		lex::Scanner<char> scanner(lexer);
+		scanner.parse(text.c_str(), text.length());
+		while (scanner.fetch_next(token))
+			;
+		scanner.dump_profile(std::cout);	// or dump_profile(out, true) for JSON
+
 *************************************************************************/
 
 
@@ -121,6 +239,9 @@ int main()
 #include "../binary.h"
 #include "exp.h"
 #include <istream>
+#include <memory>
+#include <ostream>
+#include <vector>
 
 namespace tlib
 {
@@ -138,103 +259,381 @@ class Token
 public:
 	inline Token();
 	inline Token(const Token& other);
+	/* Get the token text, copy it from input buffer if the
+	 * token was scanned from a memory buffer. */
+	inline const std::basic_string<T> get_str() const;
+	/* Get a copy of the action name. */
+	inline const std::basic_string<T> get_name() const;
 	Action action;
-	unsigned int pos;
-	unsigned int length;
+	size_t pos;
+	size_t length;
 	unsigned int line;
 	unsigned int line_pos;
-	std::basic_string<T> name;
+	/* Point to the token text in the input buffer, only available
+	 * when parsing a memory buffer, otherwise it is 0. */
+	const T* data;
+	/* Point to the action name in the lexical tables, it is kept valid
+	 * as long as the lexer. */
+	const T* name;
+	unsigned int name_length;
 	std::basic_string<T> str;
 };
 
 template <typename T> inline
 Token<T>::Token()
-: action(0), pos(0), length(0), line(0), line_pos(0)
+: action(0), pos(0), length(0), line(0), line_pos(0), data(0),
+  name(0), name_length(0)
 {
 }
 
 template <typename T> inline
 Token<T>::Token(const Token& other)
 : action(other.action), pos(other.pos), length(other.length),
-	line(other.line), line_pos(other.line_pos)
+	line(other.line), line_pos(other.line_pos), data(other.data),
+	name(other.name), name_length(other.name_length)
 {
 }
 
+template <typename T> inline
+const std::basic_string<T> Token<T>::get_str() const
+{
+	if (data)
+		return std::basic_string<T>(data, length);
+	else
+		return str;
+}
+
+template <typename T> inline
+const std::basic_string<T> Token<T>::get_name() const
+{
+	if (name)
+		return std::basic_string<T>(name, name_length);
+	else
+		return std::basic_string<T>();
+}
+
+/* Tokens fetched by Lexical::next_tokens(), every field of the tokens is
+ * stored in its own array, the token text is not copied, it can be found
+ * in the input buffer by "pos" and "length". */
+class TokenBatch
+{
+public:
+	inline size_t size() const;
+	inline void clear();
+	std::vector<Action> action;
+	std::vector<size_t> pos;
+	std::vector<size_t> length;
+	std::vector<unsigned int> line;
+	std::vector<unsigned int> line_pos;
+};
+
+inline size_t TokenBatch::size() const
+{
+	return action.size();
+}
+
+inline void TokenBatch::clear()
+{
+	action.clear();
+	pos.clear();
+	length.clear();
+	line.clear();
+	line_pos.clear();
+}
+
+// Count of the overshoot buckets of LexicalProfile.
+#define LEXICAL_PROFILE_OVERSHOOTS 17
+
+/* Counters of a scanner, they are collected only when the library is
+ * built with TLIB_LEX_PROFILE defined. */
+class LexicalProfile
+{
+public:
+	inline LexicalProfile();
+	inline void clear();
+	// Tokens (including the ignored) and the characters read for them.
+	unsigned long long tokens;
+	unsigned long long chars;
+	// Tokens that read beyond their end and seek back.
+	unsigned long long rollbacks;
+	// Tokens of every action id.
+	std::vector<unsigned long long> actions;
+	// Tokens by the count of characters read beyond the end, the last
+	// bucket counts all of the bigger ones.
+	std::vector<unsigned long long> overshoots;
+	// Visits of every state, a character read in the state is a visit.
+	std::vector<unsigned long long> states;
+};
+
+inline LexicalProfile::LexicalProfile()
+: tokens(0), chars(0), rollbacks(0)
+{
+}
+
+inline void LexicalProfile::clear()
+{
+	tokens = 0;
+	chars = 0;
+	rollbacks = 0;
+	actions.clear();
+	overshoots.clear();
+	states.clear();
+}
+
+// Maximum characters read from a stream at once.
+#define LEXICAL_READ_SIZE 4096
+
 template <typename T>
 class LexicalEnv
 {
 public:
 	inline LexicalEnv();
 	unsigned int state;
-	unsigned int begin;
-	unsigned int cur;
+	size_t begin;
+	size_t cur;
 	unsigned int line;
 	unsigned int line_pos;
 	std::basic_istream<T>* in;
+	// Characters have been read from "in" but maybe not consumed yet,
+	// "window_pos" is the position of the first character in window.
+	std::vector<T> window;
+	size_t window_pos;
+	// Memory buffer input, used when "in" is 0.
+	const T* buffer;
+	const T* buffer_end;
 };
 
 template <typename T> inline
 LexicalEnv<T>::LexicalEnv()
-: state(0), begin(0), cur(0), line(1), line_pos(1), in(0)
+: state(0), begin(0), cur(0), line(1), line_pos(1), in(0),
+  window_pos(0), buffer(0), buffer_end(0)
 {
 }
 
 
 
 
+/* Keep the compiled lexicals in 'dir', it must exist. The cache is off
+ * by default, an empty 'dir' turns it off again. */
+void set_lexical_cache(const std::string& dir);
+std::string get_lexical_cache();
+
+// Default bytes of the DFA states a lazy lexical keeps per scanner.
+#define LEXICAL_LAZY_CACHE_SIZE (8UL << 20)
+
+template <typename T>
+class LazyDfa;
+template <typename T>
+class LazyCache;
+class SearchCache;
+
+/* The compiled lexical tables, they are never changed after created, so
+ * a lexer can be loaded once and shared by the scanners of many threads. */
 template <typename T>
-class Lexical
+class CompiledLexer
 {
 public:
-	friend class syn::Syntax<T>;
-	typedef std::shared_ptr<Lexical> LexicalPtr;
+	template <typename U> friend class Scanner;
+	template <typename U> friend class RegexSet;
+	typedef std::shared_ptr<CompiledLexer> CompiledLexerPtr;
 private:
-	explicit Lexical();
+	explicit CompiledLexer();
 public:
-	~Lexical();
-	static LexicalPtr create(const std::basic_string<T>& lexical)
+	~CompiledLexer();
+	static CompiledLexerPtr create(const std::basic_string<T>& lexical)
 			throw(std::runtime_error);
-	static LexicalPtr create_by_file(const std::string& filename)
+	static CompiledLexerPtr create_by_file(const std::string& filename)
 			throw(std::runtime_error);
-	static LexicalPtr create_by_bc(const void* data, unsigned long data_len)
+	static CompiledLexerPtr create_by_bc(const void* data, unsigned long data_len)
 			throw(std::runtime_error);
-	static LexicalPtr create_by_static_bc(const void* data, unsigned long data_len)
+	static CompiledLexerPtr create_by_static_bc(const void* data, unsigned long data_len)
 			throw(std::runtime_error);
-	static LexicalPtr create_by_bc_file(const std::string& filename)
+	static CompiledLexerPtr create_by_bc_file(const std::string& filename)
 			throw(std::runtime_error);
-	static LexicalPtr create_by_stream(std::basic_istream<T>& in)
+	static CompiledLexerPtr create_by_stream(std::basic_istream<T>& in)
+			throw(std::runtime_error);
+	/* Create a lexical that scans UTF-8 text by byte, the definition is
+	 * written in wide characters and its character ranges are compiled
+	 * to the UTF-8 sequences, only for char and unsigned char. Note the
+	 * unmatched text is reported byte by byte when best_match is set. */
+	static CompiledLexerPtr create_utf8(const std::wstring& lexical)
+			throw(std::runtime_error);
+	static CompiledLexerPtr create_utf8_by_file(const std::string& filename)
+			throw(std::runtime_error);
+	static CompiledLexerPtr create_utf8_by_stream(std::wistream& in)
 			throw(std::runtime_error);
+	/* Create a lexical that keeps the position automaton and builds the DFA
+	 * states when the scanner meets them, every scanner keeps at most
+	 * 'cache_size' bytes of states and drops them all when it is full.
+	 * It is for the definitions that have too many DFA states to build
+	 * them all, it can't be saved or compressed. */
+	static CompiledLexerPtr create_lazy(const std::basic_string<T>& lexical,
+			unsigned long cache_size = LEXICAL_LAZY_CACHE_SIZE) throw(std::runtime_error);
+	static CompiledLexerPtr create_lazy_by_stream(std::basic_istream<T>& in,
+			unsigned long cache_size = LEXICAL_LAZY_CACHE_SIZE) throw(std::runtime_error);
+
+	void save_bc(const std::string& filename) const throw(std::runtime_error);
+	/* Save a C++ source of the scanner function "<name>_scan" that jumps
+	 * between the states directly instead of looking up the table, only
+	 * for char and unsigned char. */
+	void save_cpp(const std::string& filename, const std::string& name) const
+			throw(std::runtime_error);
+	/* Return a new lexer that the transit table is compressed by row
+	 * displacement, it makes the table of a big and sparse lexical much
+	 * smaller but scan a bit slower. */
+	CompiledLexerPtr compress() const throw(std::runtime_error);
+	Action get_named_action_id(const std::basic_string<T>& token_name) const;
+	inline bool lazy() const;
+private:
+	// Return null if the cached byte code can't be used.
+	static CompiledLexerPtr create_by_cache(const std::string& filename);
+	void* _data;
+	bool _allocated;
+	// Size of the mapped cache file, 0 if not mapped.
+	unsigned long _mapped;
+	// The automaton of a lazy lexical, "_data" has no states then.
+	std::shared_ptr<const LazyDfa<T> > _lazy;
+};
 
-	void save_bc(const std::string& filename) throw(std::runtime_error);
+template <typename T> inline
+bool CompiledLexer<T>::lazy() const
+{
+	return _lazy.get() != 0;
+}
+
+/* Scan state of a compiled lexer, it is cheap to create, every thread
+ * should use its own scanner. */
+template <typename T>
+class Scanner
+{
+public:
+	typedef typename CompiledLexer<T>::CompiledLexerPtr CompiledLexerPtr;
+	explicit Scanner(const CompiledLexerPtr& lexer) throw(std::runtime_error);
 
+	/* Scan a memory buffer directly, the buffer must be kept valid
+	 * until the parsing is finished. */
 	void parse(const T* input_string) throw(std::runtime_error);
 	void parse(const T* input_buffer, size_t buffer_len) throw(std::runtime_error);
+	/* Scan a stream, the stream needn't to be seekable. Note: lexical
+	 * read ahead the stream, so the stream position will be beyond the
+	 * end of the last token. */
 	void parse(std::basic_istream<T>& input_stream) throw(std::runtime_error);
 
 	/* Reset scan state and stream input pointer. */
-	void reset();
+	void reset() throw(std::runtime_error);
 	/* Get the next token. */
 	Action next_token(Token<T>& token) throw(std::runtime_error);
 	/* Get the next token, return 'false' when EOF, otherwise return
 	 * 'true' whatever the action id existed or not. */
 	bool fetch_next(Token<T>& token) throw(std::runtime_error);
+	/* Fetch at most 'max' tokens into the batch (ignored tokens are
+	 * skipped), return the count of fetched tokens, 0 means EOF. */
+	size_t next_tokens(TokenBatch& batch, size_t max) throw(std::runtime_error);
+	/* Fetch all tokens of the buffer into the batch by 'threads' threads,
+	 * 0 means one thread per processor. It doesn't affect parse(). */
+	size_t tokenize(const T* input_buffer, size_t buffer_len, TokenBatch& batch,
+			unsigned int threads = 0) throw(std::runtime_error);
+	/* Find the first token that has an action in the buffer from 'pos',
+	 * the text before it is skipped as tokenize() with best_match does,
+	 * but without scanning every token of it. Return 'false' if no such
+	 * token, otherwise set 'pos' and 'length' of the token. */
+	bool search(const T* input_buffer, size_t buffer_len, size_t& pos,
+			size_t& length) throw(std::runtime_error);
 	Action get_named_action_id(const std::basic_string<T>& token_name) const;
+	/* Counters of the scanning, they are always 0 unless the library is
+	 * built with TLIB_LEX_PROFILE. */
+	inline const LexicalProfile& profile() const;
+	void clear_profile();
+	/* Write the profile as text, or as JSON if 'json' is set. */
+	void dump_profile(std::ostream& out, bool json = false) const;
+	/* Get the line and column of a position of the memory buffer. */
+	void locate(size_t pos, unsigned int& line, unsigned int& line_pos)
+			throw(std::runtime_error);
+	inline const CompiledLexerPtr& lexer() const;
 	bool best_match;
-private:
+	/* Don't count the lines when scan a memory buffer, "line" and "line_pos"
+	 * of the tokens are 0, call locate() to get them when they are needed.
+	 * It should be set before parse(). */
+	bool lazy_lines;
+protected:
 	inline void reset_state();
+	void set_lexer(const CompiledLexerPtr& lexer);
 	void next(Token<T>& token) throw(std::runtime_error);
-private:
+	LexicalProfile* profile_data();
+protected:
 	LexicalEnv<T> _env;
+	CompiledLexerPtr _lexer;
 	void* _data;
-	bool _allocated;
+	// Positions of the new lines in the buffer before "_indexed".
+	std::vector<size_t> _lines;
+	size_t _indexed;
+	LexicalProfile _profile;
+	// The states built by this scanner if the lexer is lazy.
+	std::shared_ptr<LazyCache<T> > _cache;
+	// The unanchored automaton built by search().
+	std::shared_ptr<SearchCache> _search;
 };
 
 template <typename T> inline
-void Lexical<T>::reset_state()
+const typename Scanner<T>::CompiledLexerPtr& Scanner<T>::lexer() const
+{
+	return _lexer;
+}
+
+template <typename T> inline
+const LexicalProfile& Scanner<T>::profile() const
+{
+	return _profile;
+}
+
+template <typename T> inline
+void Scanner<T>::reset_state()
 {
 	_env.state = 0;
 }
 
+/* A scanner with its own compiled lexer. */
+template <typename T>
+class Lexical : public Scanner<T>
+{
+public:
+	friend class syn::Syntax<T>;
+	template <typename U> friend class Regex;
+	typedef std::shared_ptr<Lexical> LexicalPtr;
+	typedef typename CompiledLexer<T>::CompiledLexerPtr CompiledLexerPtr;
+private:
+	explicit Lexical(const CompiledLexerPtr& lexer);
+public:
+	static LexicalPtr create(const std::basic_string<T>& lexical)
+			throw(std::runtime_error);
+	static LexicalPtr create_by_file(const std::string& filename)
+			throw(std::runtime_error);
+	static LexicalPtr create_by_bc(const void* data, unsigned long data_len)
+			throw(std::runtime_error);
+	static LexicalPtr create_by_static_bc(const void* data, unsigned long data_len)
+			throw(std::runtime_error);
+	static LexicalPtr create_by_bc_file(const std::string& filename)
+			throw(std::runtime_error);
+	static LexicalPtr create_by_stream(std::basic_istream<T>& in)
+			throw(std::runtime_error);
+	static LexicalPtr create_utf8(const std::wstring& lexical)
+			throw(std::runtime_error);
+	static LexicalPtr create_utf8_by_file(const std::string& filename)
+			throw(std::runtime_error);
+	static LexicalPtr create_utf8_by_stream(std::wistream& in)
+			throw(std::runtime_error);
+	static LexicalPtr create_lazy(const std::basic_string<T>& lexical,
+			unsigned long cache_size = LEXICAL_LAZY_CACHE_SIZE) throw(std::runtime_error);
+	static LexicalPtr create_lazy_by_stream(std::basic_istream<T>& in,
+			unsigned long cache_size = LEXICAL_LAZY_CACHE_SIZE) throw(std::runtime_error);
+
+	void save_bc(const std::string& filename) throw(std::runtime_error);
+	void save_cpp(const std::string& filename, const std::string& name)
+			throw(std::runtime_error);
+	/* Compress the transit table, see CompiledLexer::compress(). */
+	void compress() throw(std::runtime_error);
+};
+
 
 
 
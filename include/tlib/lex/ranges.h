@@ -287,33 +287,34 @@ const RangeArray<T> operator ~ (const typename RangeArray<T>::value_type& r)
 		return RangeArray<T>::value_type::full_range - r;
 }
 
-/* Split ranges to no intersect mode. */
+/* Split ranges to no intersect mode. The bounds are sorted once and
+ * swept in order, the depth tells whether a point is covered. */
 template <class T>
 void split_range(std::vector<Range<T> >& ranges)
 {
 	typedef std::pair<int, int> RangeValue;
 	typedef std::vector<RangeValue> RangeValueArray;
 	RangeValueArray value_array;
+	value_array.reserve(ranges.size() * 2);
 	for (unsigned int i = 0; i < ranges.size(); i++)
 	{
 		value_array.push_back(RangeValue(ranges[i].min(), -1));
 		value_array.push_back(RangeValue(ranges[i].max(), 1));
 	}
-	// Maybe need a custom compare function.
+	// At the same point the begins go before the ends.
 	std::sort(value_array.begin(), value_array.end());
 	ranges.clear();
 	RangeValue m, n;
 	int t = 0;
-	while (!value_array.empty())
+	size_t k = 0;
+	while (k < value_array.size())
 	{
 		if (t == 0)
 		{
-			m = value_array.front();
-			value_array.erase(value_array.begin());
+			m = value_array[k++];
 			t -= m.second;
 		}
-		n = value_array.front();
-		value_array.erase(value_array.begin());
+		n = value_array[k++];
 		t -= n.second;
 		if (t > 0)
 		{
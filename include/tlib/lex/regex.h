@@ -27,6 +27,7 @@
 
 #include "../tlibbase.h"
 #include "lexical.h"
+#include <iterator>
 
 namespace tlib
 {
@@ -40,10 +41,30 @@ class Regex
 public:
 	inline Regex(const std::basic_string<T>& exp);
 	inline Regex(const T* exp);
+	/* Build the DFA states while matching and keep at most 'cache_size'
+	 * bytes of them, see CompiledLexer::create_lazy(). */
+	inline Regex(const std::basic_string<T>& exp, unsigned long cache_size);
 	inline Regex(const unsigned char* bc, size_t bc_len, bool is_static = false);
+	/* Share a compiled lexer, it is cheaper than loading the byte code
+	 * again when the same regex is built many times. */
+	inline explicit Regex(const typename CompiledLexer<T>::CompiledLexerPtr& lexer);
 	typename Lexical<T>::LexicalPtr _lexical;
 };
 
+template <typename T> inline
+Regex<T>::Regex(const typename CompiledLexer<T>::CompiledLexerPtr& lexer)
+{
+	_lexical.reset(new Lexical<T>(lexer));
+	_lexical->best_match = true;
+}
+
+template <typename T> inline
+Regex<T>::Regex(const std::basic_string<T>& exp, unsigned long cache_size)
+{
+	_lexical = Lexical<T>::create_lazy(std::basic_string<T>(1, (T)':') + exp, cache_size);
+	_lexical->best_match = true;
+}
+
 template <typename T> inline
 Regex<T>::Regex(const unsigned char* bc, size_t bc_len, bool is_static)
 {
@@ -107,32 +128,18 @@ const std::basic_string<T> regex_replace(const std::basic_string<T>& source,
 		throw (std::runtime_error)
 {
 	std::basic_string<T> result;
-	if (source.length() == 0)
-	{
-		return source;
-	}
-	std::basic_istringstream<T> ss(source);
-	exp._lexical->parse(ss);
 	int rep_times = 0;
-	Token<T> token;
-	while (exp._lexical->fetch_next(token))
+	size_t last = 0, pos = 0, length;
+	while ((repl_times == -1 || rep_times < repl_times)
+			&& exp._lexical->search(source.c_str(), source.length(), pos, length))
 	{
-		if (token.action == 1)
-		{
-			if (repl_times == -1 || rep_times < repl_times)
-			{
-				result += rep;
-				rep_times++;
-			}
-			else
-			{
-				result += source.substr(token.pos);
-				return result;
-			}
-		}
-		else
-			result += token.str;
+		result.append(source, last, pos - last);
+		result += rep;
+		rep_times++;
+		pos += length;
+		last = pos;
 	}
+	result.append(source, last, source.npos);
 	return result;
 }
 
@@ -143,33 +150,20 @@ const std::basic_string<T> regex_replace(const std::basic_string<T>& source,
 		_Repl rep_op, int repl_times = -1) throw (std::runtime_error)
 {
 	std::basic_string<T> result;
-	if (source.length() == 0)
-	{
-		return source;
-	}
-	std::basic_istringstream<T> ss(source);
-	exp._lexical->parse(ss);
 	int rep_times = 0;
-	Token<T> token;
-	while (exp._lexical->fetch_next(token))
+	size_t last = 0, pos = 0, length;
+	while ((repl_times == -1 || rep_times < repl_times)
+			&& exp._lexical->search(source.c_str(), source.length(), pos, length))
 	{
-		if (token.action == 1)
-		{
-			if (repl_times == -1 || rep_times < repl_times)
-			{
-				rep_op(token.str);
-				result += token.str;
-				rep_times++;
-			}
-			else
-			{
-				result += source.substr(token.pos);
-				return result;
-			}
-		}
-		else
-			result += token.str;
+		result.append(source, last, pos - last);
+		std::basic_string<T> str(source, pos, length);
+		rep_op(str);
+		result += str;
+		rep_times++;
+		pos += length;
+		last = pos;
 	}
+	result.append(source, last, source.npos);
 	return result;
 }
 
@@ -178,21 +172,11 @@ size_t regex_find(const std::basic_string<T>& source,
 		const Regex<T>& exp, std::basic_string<T>& fnd, size_t start = 0)
 		throw (std::runtime_error)
 {
-	if (start >= source.length())
+	size_t length;
+	if (!exp._lexical->search(source.c_str(), source.length(), start, length))
 		return source.npos;
-
-	std::basic_istringstream<T> ss(source.c_str() + start);
-	exp._lexical->parse(ss);
-	Token<T> token;
-	while (exp._lexical->fetch_next(token))
-	{
-		if (token.action == 1)
-		{
-			fnd = token.str;
-			return start + token.pos;
-		}
-	}
-	return source.npos;
+	fnd.assign(source, start, length);
+	return start;
 }
 
 
@@ -200,18 +184,195 @@ template <typename T>
 size_t regex_find(const std::basic_string<T>& source,
 		const Regex<T>& exp, size_t start = 0) throw (std::runtime_error)
 {
-	if (start >= source.length())
+	size_t length;
+	if (!exp._lexical->search(source.c_str(), source.length(), start, length))
 		return source.npos;
+	return start;
+}
+
+
+/* Iterate the matches of a regex in a memory buffer, every match is a
+ * token that points into the buffer ("pos", "length" and "data" are set,
+ * "str" is empty), the next match is searched only when the iterator is
+ * advanced. The buffer and the regex must be kept valid while iterating,
+ * a default constructed iterator is the end. */
+template <typename T>
+class RegexIterator
+{
+public:
+	typedef std::forward_iterator_tag iterator_category;
+	typedef Token<T> value_type;
+	typedef ptrdiff_t difference_type;
+	typedef const Token<T>* pointer;
+	typedef const Token<T>& reference;
 
-	std::basic_istringstream<T> ss(source.c_str() + start);
-	exp._lexical->parse(ss);
-	Token<T> token;
-	while (exp._lexical->fetch_next(token))
+	inline RegexIterator();
+	inline RegexIterator(const T* source, size_t length, const Regex<T>& exp,
+			size_t start = 0) throw (std::runtime_error);
+	inline RegexIterator(const std::basic_string<T>& source, const Regex<T>& exp,
+			size_t start = 0) throw (std::runtime_error);
+	inline const Token<T>& operator * () const;
+	inline const Token<T>* operator -> () const;
+	inline RegexIterator& operator ++ () throw (std::runtime_error);
+	inline RegexIterator operator ++ (int) throw (std::runtime_error);
+	inline bool operator == (const RegexIterator& other) const;
+	inline bool operator != (const RegexIterator& other) const;
+private:
+	inline void find(size_t start) throw (std::runtime_error);
+	const T* _source;
+	size_t _length;
+	const Regex<T>* _exp;
+	Token<T> _token;
+};
+
+template <typename T> inline
+RegexIterator<T>::RegexIterator()
+: _source(0), _length(0), _exp(0)
+{
+}
+
+template <typename T> inline
+RegexIterator<T>::RegexIterator(const T* source, size_t length,
+		const Regex<T>& exp, size_t start) throw (std::runtime_error)
+: _source(source), _length(length), _exp(&exp)
+{
+	_token.action = 1;
+	find(start);
+}
+
+template <typename T> inline
+RegexIterator<T>::RegexIterator(const std::basic_string<T>& source,
+		const Regex<T>& exp, size_t start) throw (std::runtime_error)
+: _source(source.c_str()), _length(source.length()), _exp(&exp)
+{
+	_token.action = 1;
+	find(start);
+}
+
+template <typename T> inline
+void RegexIterator<T>::find(size_t start) throw (std::runtime_error)
+{
+	size_t length;
+	if (_exp->_lexical->search(_source, _length, start, length))
 	{
-		if (token.action == 1)
-			return start + token.pos;
+		_token.pos = start;
+		_token.length = length;
+		_token.data = _source + start;
 	}
-	return source.npos;
+	else
+	{
+		// Become the end iterator.
+		_source = 0;
+		_length = 0;
+		_exp = 0;
+		_token.pos = 0;
+		_token.length = 0;
+		_token.data = 0;
+	}
+}
+
+template <typename T> inline
+const Token<T>& RegexIterator<T>::operator * () const
+{
+	return _token;
+}
+
+template <typename T> inline
+const Token<T>* RegexIterator<T>::operator -> () const
+{
+	return &_token;
+}
+
+template <typename T> inline
+RegexIterator<T>& RegexIterator<T>::operator ++ () throw (std::runtime_error)
+{
+	// A match is never empty, so the search always moves forward.
+	if (_exp)
+		find(_token.pos + _token.length);
+	return *this;
+}
+
+template <typename T> inline
+RegexIterator<T> RegexIterator<T>::operator ++ (int) throw (std::runtime_error)
+{
+	RegexIterator old(*this);
+	++*this;
+	return old;
+}
+
+template <typename T> inline
+bool RegexIterator<T>::operator == (const RegexIterator& other) const
+{
+	return _source == other._source && _token.pos == other._token.pos;
+}
+
+template <typename T> inline
+bool RegexIterator<T>::operator != (const RegexIterator& other) const
+{
+	return !(*this == other);
+}
+
+/* Append the position and length of all matches from 'start' to the
+ * batch ("line" and "line_pos" are 0), return the count of matches. */
+template <typename T>
+size_t regex_find_all(const std::basic_string<T>& source,
+		const Regex<T>& exp, TokenBatch& batch, size_t start = 0)
+		throw (std::runtime_error)
+{
+	size_t count = 0;
+	RegexIterator<T> end;
+	for (RegexIterator<T> it(source, exp, start); it != end; ++it, count++)
+	{
+		batch.action.push_back(it->action);
+		batch.pos.push_back(it->pos);
+		batch.length.push_back(it->length);
+		batch.line.push_back(0);
+		batch.line_pos.push_back(0);
+	}
+	return count;
+}
+
+
+template <typename T>
+class SetCache;
+
+/* Many patterns compiled into one automaton, match() finds all patterns
+ * that match somewhere in the text by reading it once. The id of a pattern
+ * is its index, a pattern matches as if regex_find() finds it. The states
+ * are built while matching and at most 'cache_size' bytes of them are kept,
+ * see CompiledLexer::create_lazy(), so a set should be used by one thread. */
+template <typename T>
+class RegexSet
+{
+public:
+	explicit RegexSet(const std::vector<std::basic_string<T> >& patterns,
+			unsigned long cache_size = LEXICAL_LAZY_CACHE_SIZE) throw(std::runtime_error);
+	/* Set 'ids' to the sorted ids of the matched patterns, return 'false'
+	 * if none matched. */
+	bool match(const T* input_buffer, size_t buffer_len,
+			std::vector<unsigned int>& ids) throw(std::runtime_error);
+	inline bool match(const std::basic_string<T>& input,
+			std::vector<unsigned int>& ids) throw(std::runtime_error);
+	inline size_t size() const;
+private:
+	size_t _count;
+	typename CompiledLexer<T>::CompiledLexerPtr _lexer;
+	std::shared_ptr<SetCache<T> > _cache;
+	// Whether an action is matched in the current text.
+	std::vector<unsigned char> _found;
+};
+
+template <typename T> inline
+bool RegexSet<T>::match(const std::basic_string<T>& input,
+		std::vector<unsigned int>& ids) throw(std::runtime_error)
+{
+	return match(input.c_str(), input.length(), ids);
+}
+
+template <typename T> inline
+size_t RegexSet<T>::size() const
+{
+	return _count;
 }
 
 
@@ -123,6 +123,75 @@ inline void Spin::unlock() {
 #endif
 }
 
+/* Run 'proc' in a new thread, the thread is joined by join() or
+ * at destruction. */
+class Thread {
+public:
+	typedef void (*Proc)(void* param);
+	inline Thread(Proc proc, void* param);
+	inline ~Thread();
+	inline void join();
+private:
+	Thread(const Thread&);
+	Thread& operator = (const Thread&);
+#ifdef __MSVC__
+	static DWORD WINAPI run(LPVOID self);
+	HANDLE _thread;
+#elif defined(__GNUC__)
+	static void* run(void* self);
+	pthread_t _thread;
+	bool _joinable;
+#endif
+	Proc _proc;
+	void* _param;
+};
+
+inline Thread::Thread(Proc proc, void* param)
+: _proc(proc), _param(param) {
+#ifdef __MSVC__
+	_thread = CreateThread(0, 0, run, this, 0, 0);
+	if (!_thread)
+		_proc(_param);
+#elif defined(__GNUC__)
+	_joinable = pthread_create(&_thread, 0, run, this) == 0;
+	if (!_joinable)
+		_proc(_param);
+#else
+#error not implement.
+#endif
+}
+
+inline Thread::~Thread() {
+	join();
+}
+
+inline void Thread::join() {
+#ifdef __MSVC__
+	if (_thread) {
+		WaitForSingleObject(_thread, INFINITE);
+		CloseHandle(_thread);
+		_thread = 0;
+	}
+#elif defined(__GNUC__)
+	if (_joinable) {
+		pthread_join(_thread, 0);
+		_joinable = false;
+	}
+#endif
+}
+
+#ifdef __MSVC__
+inline DWORD WINAPI Thread::run(LPVOID self) {
+	((Thread*)self)->_proc(((Thread*)self)->_param);
+	return 0;
+}
+#elif defined(__GNUC__)
+inline void* Thread::run(void* self) {
+	((Thread*)self)->_proc(((Thread*)self)->_param);
+	return 0;
+}
+#endif
+
 template<typename TRes>
 class Lock {
 public:
@@ -44,6 +44,19 @@ std::string get_exec_path();
 // Full path of current logged-in user's home path.
 std::string get_home_path();
 
+// Count of the online processors, at least 1.
+unsigned int get_cpu_count();
+
+// Id of the current process.
+unsigned long get_process_id();
+
+// Map a whole file into memory for reading, return 0 if failed or the
+// file is empty.
+const void* map_file(const std::string& filename, unsigned long& size);
+
+// Release the memory returned by map_file().
+void unmap_file(const void* data, unsigned long size);
+
 }
 
 #endif /* TLIBSYS_H_ */
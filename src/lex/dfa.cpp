@@ -23,8 +23,7 @@
 **************************************************************************/
 
 #include "../../include/tlib/lex/dfa.h"
-#include <map>
-#include <set>
+#include <algorithm>
 #include <vector>
 
 namespace tlib
@@ -42,15 +41,89 @@ struct RangeInfo
 };
 
 
+/* A node of the position sets, a leaf is one position and the others
+ * are the union of two sets, so a parent shares the sets of its children
+ * instead of copying them. */
+struct PosSet
+{
+	// The position of a leaf, or the handle of the left set.
+	unsigned int left;
+	// The handle of the right set, 0 for a leaf.
+	unsigned int right;
+};
+
 template <class T>
 struct ComputeInfo
 {
 	typedef vector<RangeInfo<T> > PosRangeArray;
 	typedef vector<unsigned int> PosArray;
-	typedef vector<PosArray> FollowArray;
 	PosRangeArray pos_ranges;
-	FollowArray follows;
+	// Handle of the follow positions of every position.
+	PosArray follows;
+	// The set nodes, handle 0 is the empty set.
+	vector<PosSet> sets;
 	unsigned int id; // A counter use to identify nodes
+
+	inline unsigned int leaf(unsigned int pos)
+	{
+		PosSet set = { pos, 0 };
+		sets.push_back(set);
+		return (unsigned int)sets.size() - 1;
+	}
+
+	inline unsigned int join(unsigned int a, unsigned int b)
+	{
+		if (a == 0)
+			return b;
+		if (b == 0)
+			return a;
+		PosSet set = { a, b };
+		sets.push_back(set);
+		return (unsigned int)sets.size() - 1;
+	}
+
+	/* Append the positions of the set to 'out', the positions of a
+	 * follow set may repeat. */
+	void collect(unsigned int set, PosArray& out)
+	{
+		if (set == 0)
+			return;
+		_stack.push_back(set);
+		while (!_stack.empty())
+		{
+			const PosSet& node = sets[_stack.back()];
+			_stack.pop_back();
+			if (node.right == 0)
+				out.push_back(node.left);
+			else
+			{
+				_stack.push_back(node.right);
+				_stack.push_back(node.left);
+			}
+		}
+	}
+
+	// Set the action of the positions of the set.
+	void set_action(unsigned int set, Action action)
+	{
+		_list.clear();
+		collect(set, _list);
+		for (unsigned int i = 0; i < _list.size(); ++i)
+			pos_ranges[_list[i]].action = action;
+	}
+
+	// Add the positions of 'first' to the follows of the positions of 'last'.
+	void add_follows(unsigned int last, unsigned int first)
+	{
+		_list.clear();
+		collect(last, _list);
+		for (unsigned int i = 0; i < _list.size(); ++i)
+			follows[_list[i]] = join(follows[_list[i]], first);
+	}
+
+private:
+	PosArray _stack;
+	PosArray _list;
 };
 
 template <class T>
@@ -62,77 +135,40 @@ void compute_node(typename Exp<T>::ExpPtr exp, void *param)
 	{
 		exp->nullable = exp->exp.left->nullable
 				|| exp->exp.right->nullable;
-		exp->firstpos.insert(exp->firstpos.end(),
-				exp->exp.left->firstpos.begin(),
-				exp->exp.left->firstpos.end());
-		exp->firstpos.insert(exp->firstpos.end(),
-				exp->exp.right->firstpos.begin(),
-				exp->exp.right->firstpos.end());
-		exp->lastpos.insert(exp->lastpos.end(),
-				exp->exp.left->lastpos.begin(),
-				exp->exp.left->lastpos.end());
-		exp->lastpos.insert(exp->lastpos.end(),
-				exp->exp.right->lastpos.begin(),
-				exp->exp.right->lastpos.end());
+		exp->firstpos = context->join(exp->exp.left->firstpos,
+				exp->exp.right->firstpos);
+		exp->lastpos = context->join(exp->exp.left->lastpos,
+				exp->exp.right->lastpos);
 		if (exp->action != 0)
-		{
-			for (unsigned int i = 0; i < exp->lastpos.size(); ++i)
-			{
-				context->pos_ranges[exp->lastpos[i]].action = exp->action;
-			}
-		}
+			context->set_action(exp->lastpos, exp->action);
 	}
 	else if (exp->type == RE_NODE_AND)
 	{
 		exp->nullable = exp->exp.left->nullable
 				&& exp->exp.right->nullable;
-		exp->firstpos.insert(exp->firstpos.end(),
-				exp->exp.left->firstpos.begin(),
-				exp->exp.left->firstpos.end());
+		exp->firstpos = exp->exp.left->firstpos;
 		if (exp->exp.left->nullable)
-			exp->firstpos.insert(exp->firstpos.end(),
-					exp->exp.right->firstpos.begin(),
-					exp->exp.right->firstpos.end());
+			exp->firstpos = context->join(exp->firstpos,
+					exp->exp.right->firstpos);
+		exp->lastpos = exp->exp.right->lastpos;
 		if (exp->exp.right->nullable)
-			exp->lastpos.insert(exp->lastpos.end(),
-					exp->exp.left->lastpos.begin(),
-					exp->exp.left->lastpos.end());
-		exp->lastpos.insert(exp->lastpos.end(),
-				exp->exp.right->lastpos.begin(),
-				exp->exp.right->lastpos.end());
+			exp->lastpos = context->join(exp->exp.left->lastpos,
+					exp->lastpos);
 		if (exp->action != 0)
-		{
-			for (unsigned int i = 0; i < exp->lastpos.size(); ++i)
-			{
-				context->pos_ranges[exp->lastpos[i]].action = exp->action;
-			}
-		}
+			context->set_action(exp->lastpos, exp->action);
 		// Compute follow pos for AND operator.
-		vector<unsigned int>::iterator it = exp->exp.left->lastpos.begin();
-		while (it != exp->exp.left->lastpos.end())
-		{
-			if (context->follows.size() < *it + 1)
-			{
-				context->follows.resize(*it + 1);
-			}
-			context->follows[*it].insert(context->follows[*it].end(),
-					exp->exp.right->firstpos.begin(),
-					exp->exp.right->firstpos.end());
-			++it;
-		}
+		context->add_follows(exp->exp.left->lastpos, exp->exp.right->firstpos);
 	}
 	else if (exp->type == RE_NODE_RANGE)
 	{
 		exp->nullable = false;
-		exp->firstpos.push_back(context->id);
-		exp->lastpos.push_back(context->id);
-		if (context->pos_ranges.size() < context->id + 1)
-		{
-			context->pos_ranges.resize(context->id + 1);
-			context->follows.resize(context->id + 1);
-		}
-		context->pos_ranges[context->id].range = exp->range;
-		context->pos_ranges[context->id].action = exp->action;
+		exp->firstpos = context->leaf(context->id);
+		exp->lastpos = exp->firstpos;
+		RangeInfo<T> info;
+		info.range = exp->range;
+		info.action = exp->action;
+		context->pos_ranges.push_back(info);
+		context->follows.push_back(0);
 		context->id++;
 	}
 	else
@@ -141,70 +177,42 @@ void compute_node(typename Exp<T>::ExpPtr exp, void *param)
 			exp->nullable = true;
 		else if (exp->type == RE_NODE_PLUS)
 			exp->nullable = false;
-		exp->firstpos.insert(exp->firstpos.end(),
-				exp->child->firstpos.begin(),
-				exp->child->firstpos.end());
-		exp->lastpos.insert(exp->lastpos.end(),
-				exp->child->lastpos.begin(),
-				exp->child->lastpos.end());
+		exp->firstpos = exp->child->firstpos;
+		exp->lastpos = exp->child->lastpos;
 		if (exp->action != 0)
-		{
-			for (unsigned int i = 0; i < exp->lastpos.size(); ++i)
-			{
-				context->pos_ranges[exp->lastpos[i]].action = exp->action;
-			}
-		}
+			context->set_action(exp->lastpos, exp->action);
 		if (exp->type == RE_NODE_CLOSURE || exp->type == RE_NODE_PLUS)
-		{
-			vector<unsigned int>::iterator it = exp->lastpos.begin();
-			while (it != exp->lastpos.end())
-			{
-				if (context->follows.size() < *it + 1)
-				{
-					context->follows.resize(*it + 1);
-				}
-				context->follows[*it].insert(context->follows[*it].end(),
-						exp->firstpos.begin(), 
-						exp->firstpos.end());
-				++it;
-			}
-		}
+			context->add_follows(exp->lastpos, exp->firstpos);
 	}
 }
 
-/* Compute the expression's node values.  */
 template <class T>
-void make_dfa(typename Exp<T>::ExpPtr exp, Dfa<T>& dfa)
+void make_nfa(typename Exp<T>::ExpPtr exp, Nfa<T>& nfa)
 {
-	typedef typename ComputeInfo<T>::PosArray PosArray;
-	typedef map<PosArray, unsigned int> StateMap;
 	ComputeInfo<T> context;
 	// Initialize counter.
 	context.id = 0;
+	context.sets.resize(1);
 	// First, extend the expression with <EOF> mark.
-	Range<T> range = Range<T>::empty_range;
-	typename Exp<T>::ExpPtr root(
-		new Exp<T>(RE_NODE_AND, exp, typename Exp<T>::ExpPtr(new Exp<T>(range))));
+	Exp<T> eof(Range<T>::empty_range);
+	Exp<T> root(RE_NODE_AND, exp, &eof);
 	// Compute nullable, firstpos, lastpos and followpos array.
-	exp_depth_travel<T>(root, compute_node<T>, &context);
+	exp_depth_travel<T>(&root, compute_node<T>, &context);
 
 	// An id of the node that a range node of <EOF>
-	unsigned int finished_id = 0;
+	nfa.finished_id = 0;
 	for (unsigned int i = 0; i < context.pos_ranges.size(); i++)
 	{
-		if (context.follows[i].size() == 0)
+		if (context.follows[i] == 0)
 		{
-			finished_id = i;
+			nfa.finished_id = i;
 			break;
 		}
 	}
 
-	unsigned int state_id = 0;
-	StateMap marked_map, unmark_map;
-	unmark_map[root->firstpos] = state_id++;
-
 	// Get all of the input except the last ZERO symbol.
-	typename Dfa<T>::RangeVector ranges;
+	typename Nfa<T>::RangeVector& ranges = nfa.range_map;
+	ranges.clear();
 	for (unsigned int i = 0; i < context.pos_ranges.size() - 1; i++)
 	{
 		ranges.push_back(context.pos_ranges[i].range);
@@ -213,91 +221,154 @@ void make_dfa(typename Exp<T>::ExpPtr exp, Dfa<T>& dfa)
 	// Thor Qin range split algorithm. :-)
 	split_range<T>(ranges);
 
-	dfa.range_map.reserve(ranges.size());
-	dfa.range_map.insert(dfa.range_map.begin(), ranges.begin(), ranges.end());
+	// The split ranges are sorted and never intersect, so a position
+	// covers a run of them, find it once instead of for every state.
+	unsigned int pos_count = (unsigned int)context.pos_ranges.size();
+	nfa.actions.resize(pos_count);
+	nfa.cover_begin.assign(pos_count, 0);
+	nfa.cover_end.assign(pos_count, 0);
+	nfa.follow_begin.resize(pos_count + 1);
+	nfa.follows.clear();
+	vector<unsigned int> seen((pos_count + 31) / 32, 0);
+	for (unsigned int p = 0; p < pos_count; p++)
+	{
+		nfa.actions[p] = context.pos_ranges[p].action;
+		unsigned int begin = (unsigned int)nfa.follows.size();
+		nfa.follow_begin[p] = begin;
+		context.collect(context.follows[p], nfa.follows);
+		// Drop the repeated follow positions.
+		unsigned int end = begin;
+		for (unsigned int f = begin; f < nfa.follows.size(); f++)
+		{
+			unsigned int follow = nfa.follows[f];
+			unsigned int bit = 1U << (follow & 31);
+			if (seen[follow >> 5] & bit)
+				continue;
+			seen[follow >> 5] |= bit;
+			nfa.follows[end++] = follow;
+		}
+		nfa.follows.resize(end);
+		for (unsigned int f = begin; f < end; f++)
+			seen[nfa.follows[f] >> 5] = 0;
+
+		const Range<T>& r = context.pos_ranges[p].range;
+		if (r.empty())
+			continue;
+		unsigned int lo = 0, hi = (unsigned int)ranges.size();
+		while (lo < hi)
+		{
+			unsigned int mid = (lo + hi) / 2;
+			if (ranges[mid].max() < r.min())
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		nfa.cover_begin[p] = lo;
+		while (lo < ranges.size() && relation<T>(r, ranges[lo]) != R_UNRELATED)
+			lo++;
+		nfa.cover_end[p] = lo;
+	}
+	nfa.follow_begin[pos_count] = (unsigned int)nfa.follows.size();
+
+	nfa.first.clear();
+	context.collect(root.firstpos, nfa.first);
+	sort(nfa.first.begin(), nfa.first.end());
+}
+
+/* Compute the expression's node values.  */
+template <class T>
+void make_dfa(typename Exp<T>::ExpPtr exp, Dfa<T>& dfa)
+{
+	typedef vector<unsigned int> PosArray;
+	Nfa<T> nfa;
+	make_nfa(exp, nfa);
+	const typename Nfa<T>::RangeVector& ranges = nfa.range_map;
+	dfa.range_map = ranges;
+
+	StateSets states;
+	states.find_or_add(nfa.first);
 
-	while (!unmark_map.empty())
+	// Positions of the state by every range, the ranges in use and a
+	// bitset to drop the repeated follow positions.
+	vector<PosArray> range_pos(ranges.size());
+	vector<unsigned int> used_ranges;
+	vector<unsigned int> seen((nfa.actions.size() + 31) / 32, 0);
+	PosArray to_state;
+
+	// Every new state is added to the end, so walk them as a queue.
+	for (unsigned int id = 0; id < states.size(); id++)
 	{
-		// Add to marked collection.
-		PosArray pos_array = unmark_map.begin()->first;
-		unsigned int id = unmark_map.begin()->second;
-		marked_map[pos_array] = id;
-		unmark_map.erase(unmark_map.begin());
+		used_ranges.clear();
+		for (const unsigned int* it = states.begin(id); it != states.end(id); ++it)
+		{
+			for (unsigned int i = nfa.cover_begin[*it]; i < nfa.cover_end[*it]; i++)
+			{
+				if (range_pos[i].empty())
+					used_ranges.push_back(i);
+				range_pos[i].push_back(*it);
+			}
+		}
+		sort(used_ranges.begin(), used_ranges.end());
 
-		for (unsigned int i = 0; i < ranges.size(); i++)
+		for (unsigned int k = 0; k < used_ranges.size(); k++)
 		{
-			// Check every non-intersect ranges.
+			unsigned int i = used_ranges[k];
 			Action range_action = 0;
-			PosArray to_state;
-			set<unsigned int> to_set;
-			for (unsigned int j = 0; j < pos_array.size(); j++)
+			to_state.clear();
+			for (unsigned int j = 0; j < range_pos[i].size(); j++)
 			{
-				if (relation<T>(context.pos_ranges[pos_array[j]].range, ranges[i])
-						!= R_UNRELATED)
+				unsigned int pos = range_pos[i][j];
+				// Sometimes the definition of regular expressions will be
+				// made into a conflict, such as "IF", it both can be used as
+				// a keyword or an ID symbol, So, should us return the "keyword IF" or
+				// the "variable name IF"?
+				// Here actually has two strategies: Either is the first definition has
+				// a higher priority, or the later definition cover the before.
+				// For use strategy 1, add:
+				//		"range_action == 0"
+				// For use strategy 2:
+				//		"nfa.actions[pos] != 0"
+				// Choose between the two.
+				// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+				if (range_action == 0)
+				// if (nfa.actions[pos] != 0)
+					range_action = nfa.actions[pos];
+				// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+				for (unsigned int f = nfa.follow_begin[pos]; f < nfa.follow_begin[pos + 1]; f++)
 				{
-					// Sometimes the definition of regular expressions will be
-					// made into a conflict, such as "IF", it both can be used as
-					// a keyword or an ID symbol, So, should us return the "keyword IF" or
-					// the "variable name IF"?
-					// Here actually has two strategies: Either is the first definition has
-					// a higher priority, or the later definition cover the before.
-					// For use strategy 1, add:
-					//		"range_action == 0"
-					// For use strategy 2:
-					//		"context.pos_ranges[pos_array[j]].action != 0"
-					// Choose between the two.
-					// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-					if (range_action == 0)
-					// if (context.pos_ranges[pos_array[j]].action != 0)
-						range_action = context.pos_ranges[pos_array[j]].action;
-					// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-					to_set.insert(context.follows[pos_array[j]].begin(),
-							context.follows[pos_array[j]].end());
+					unsigned int follow = nfa.follows[f];
+					unsigned int bit = 1U << (follow & 31);
+					if (seen[follow >> 5] & bit)
+						continue;
+					seen[follow >> 5] |= bit;
+					to_state.push_back(follow);
 				}
 			}
-			to_state.insert(to_state.end(), to_set.begin(), to_set.end());
+			range_pos[i].clear();
+			for (unsigned int f = 0; f < to_state.size(); f++)
+				seen[to_state[f] >> 5] = 0;
 			if (!to_state.empty())
 			{
-				if (marked_map.find(to_state) != marked_map.end())
-				{
-					Transit t =
-					{id, marked_map[to_state], i, range_action};
-					dfa.transits.push_back(t);
-				}
-				else if (unmark_map.find(to_state) != unmark_map.end())
-				{
-					Transit t =
-					{id, unmark_map[to_state], i, range_action};
-					dfa.transits.push_back(t);
-				}
-				else
-				{
-					unmark_map[to_state] = state_id++;
-					Transit t =
-					{id, unmark_map[to_state], i, range_action};
-					dfa.transits.push_back(t);
-				}
+				sort(to_state.begin(), to_state.end());
+				Transit t =
+				{id, states.find_or_add(to_state), i, range_action};
+				dfa.transits.push_back(t);
 			}
 		}
 	}
 
-	dfa.total_states = (unsigned int)marked_map.size();
-	// So, in the end, "marked_map" have all of the states.
-	for (typename StateMap::iterator it = marked_map.begin();
-			it != marked_map.end(); ++it)
+	dfa.total_states = states.size();
+	// Record the group that have the final state.
+	for (unsigned int id = 0; id < states.size(); id++)
 	{
-		// Record the group that have the final state.
-		for (unsigned int i = 0; i < it->first.size(); ++i)
-		{
-			if (it->first[i] == finished_id)
-			{
-				dfa.accepting_states.push_back(it->second);
-				break;
-			}
-		}
+		if (binary_search(states.begin(id), states.end(id), nfa.finished_id))
+			dfa.accepting_states.push_back(id);
 	}
 }
 
+template void make_nfa<char>(Exp<char>::ExpPtr exp, Nfa<char>& nfa);
+template void make_nfa<unsigned char>(Exp<unsigned char>::ExpPtr exp, Nfa<unsigned char>& nfa);
+template void make_nfa<wchar_t>(Exp<wchar_t>::ExpPtr exp, Nfa<wchar_t>& nfa);
 template void make_dfa<char>(Exp<char>::ExpPtr exp, Dfa<char>& dfa);
 template void make_dfa<unsigned char>(Exp<unsigned char>::ExpPtr exp, Dfa<unsigned char>& dfa);
 template void make_dfa<wchar_t>(Exp<wchar_t>::ExpPtr exp, Dfa<wchar_t>& dfa);
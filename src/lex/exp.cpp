@@ -44,11 +44,30 @@ using namespace std;
 
 
 
+template <class T>
+Exp<T>::Exp()
+{
+	type = RE_NODE_RANGE;
+	exp.left = 0;
+	exp.right = 0;
+	child = 0;
+	nullable = false;
+	firstpos = 0;
+	lastpos = 0;
+	action = 0;
+}
+
 template <class T>
 Exp<T>::Exp(const Range<T>& r)
 {
 	type = RE_NODE_RANGE;
 	range = r;
+	exp.left = 0;
+	exp.right = 0;
+	child = 0;
+	nullable = false;
+	firstpos = 0;
+	lastpos = 0;
 	action = 0;
 }
 
@@ -59,6 +78,10 @@ Exp<T>::Exp(NodeType t, ExpPtr l, ExpPtr r)
 	type = t;
 	exp.left = l;
 	exp.right = r;
+	child = 0;
+	nullable = false;
+	firstpos = 0;
+	lastpos = 0;
 	action = 0;
 }
 
@@ -67,10 +90,65 @@ template <class T>
 Exp<T>::Exp(NodeType t, ExpPtr c)
 {
 	type = t;
+	exp.left = 0;
+	exp.right = 0;
 	child = c;
+	nullable = false;
+	firstpos = 0;
+	lastpos = 0;
 	action = 0;
 }
 
+template <class T>
+ExpPool<T>::ExpPool()
+: _used(EXP_POOL_BLOCK)
+{
+}
+
+template <class T>
+ExpPool<T>::~ExpPool()
+{
+	for (size_t i = 0; i < _blocks.size(); i++)
+		delete [] _blocks[i];
+}
+
+template <class T> inline
+typename Exp<T>::ExpPtr ExpPool<T>::alloc()
+{
+	if (_used == EXP_POOL_BLOCK)
+	{
+		_blocks.reserve(_blocks.size() + 1);
+		_blocks.push_back(new Exp<T>[EXP_POOL_BLOCK]);
+		_used = 0;
+	}
+	return _blocks.back() + _used++;
+}
+
+template <class T>
+typename Exp<T>::ExpPtr ExpPool<T>::create(const Range<T>& r)
+{
+	typename Exp<T>::ExpPtr exp = alloc();
+	*exp = Exp<T>(r);
+	return exp;
+}
+
+template <class T>
+typename Exp<T>::ExpPtr ExpPool<T>::create(NodeType t, typename Exp<T>::ExpPtr c)
+{
+	typename Exp<T>::ExpPtr exp = alloc();
+	*exp = Exp<T>(t, c);
+	return exp;
+}
+
+template <class T>
+typename Exp<T>::ExpPtr ExpPool<T>::create(NodeType t, typename Exp<T>::ExpPtr l,
+		typename Exp<T>::ExpPtr r)
+{
+	typename Exp<T>::ExpPtr exp = alloc();
+	*exp = Exp<T>(t, l, r);
+	return exp;
+}
+
 
 /* Priority is use "Queued operator" .VS. "Current operator". */
 static char priority_map[OP_EOF + 1][OP_EOF + 1] =
@@ -88,7 +166,7 @@ static char priority_map[OP_EOF + 1][OP_EOF + 1] =
 
 /* Compare the queued operator and scan operator and make expression. */
 template <class T>
-bool parse_op(stack<OperatorType> &op_stack,
+bool parse_op(ExpPool<T>& pool, stack<OperatorType> &op_stack,
 		stack<typename Exp<T>::ExpPtr>& exp_stack,
 		OperatorType scan_op)
 {
@@ -111,8 +189,8 @@ bool parse_op(stack<OperatorType> &op_stack,
 
 				typename Exp<T>::ExpPtr exp_left = exp_stack.top();
 				exp_stack.pop();
-				typename Exp<T>::ExpPtr exp_op(new Exp<T>(static_cast<NodeType>
-					(RE_NODE_AND + (queue_op - OP_AND)), exp_left, exp_right));
+				typename Exp<T>::ExpPtr exp_op = pool.create(static_cast<NodeType>
+					(RE_NODE_AND + (queue_op - OP_AND)), exp_left, exp_right);
 				exp_stack.push(exp_op);
 			}
 			else
@@ -135,12 +213,15 @@ bool parse_op(stack<OperatorType> &op_stack,
 	}
 }
 
-template Exp<char>::ExpPtr exp_parse(const char* expression) throw(runtime_error);
-template Exp<unsigned char>::ExpPtr exp_parse(const unsigned char* expression) throw(runtime_error);
-template Exp<wchar_t>::ExpPtr exp_parse(const wchar_t* expression) throw(runtime_error);
+template Exp<char>::ExpPtr exp_parse(ExpPool<char>& pool,
+		const char* expression) throw(runtime_error);
+template Exp<unsigned char>::ExpPtr exp_parse(ExpPool<unsigned char>& pool,
+		const unsigned char* expression) throw(runtime_error);
+template Exp<wchar_t>::ExpPtr exp_parse(ExpPool<wchar_t>& pool,
+		const wchar_t* expression) throw(runtime_error);
 
 template <class T>
-typename Exp<T>::ExpPtr exp_parse(const T* expression) throw(runtime_error)
+typename Exp<T>::ExpPtr exp_parse(ExpPool<T>& pool, const T* expression) throw(runtime_error)
 {
 	ExpScanner<T> scanner(expression);
 	stack<OperatorType> op_stack;
@@ -155,8 +236,7 @@ typename Exp<T>::ExpPtr exp_parse(const T* expression) throw(runtime_error)
 		scanner.next_token(token);
 		if (token.type == TOKEN_VALUE)
 		{
-			typename Exp<T>::ExpPtr exp(new Exp<T>(token.range));
-			exp_stack.push(exp);
+			exp_stack.push(pool.create(token.range));
 		}
 		else if (token.type == TOKEN_OPERATOR)
 		{
@@ -167,13 +247,13 @@ typename Exp<T>::ExpPtr exp_parse(const T* expression) throw(runtime_error)
 					goto ErrorClean;
 				typename Exp<T>::ExpPtr exp_child = exp_stack.top();
 				exp_stack.pop();
-				typename Exp<T>::ExpPtr exp_op(new Exp<T>(static_cast<NodeType>
-					(RE_NODE_QUESTION + (scan_op - OP_QUESTION)), exp_child));
+				typename Exp<T>::ExpPtr exp_op = pool.create(static_cast<NodeType>
+					(RE_NODE_QUESTION + (scan_op - OP_QUESTION)), exp_child);
 				exp_stack.push(exp_op);
 			}
 			else
 			{
-				if (!parse_op<T>(op_stack, exp_stack, scan_op))
+				if (!parse_op<T>(pool, op_stack, exp_stack, scan_op))
 					goto ErrorClean;
 				if (scan_op == OP_EOF)
 					break;
@@ -283,9 +363,154 @@ void exp_depth_travel(typename Exp<T>::ExpPtr exp,
 	}
 }
 
+// Byte ranges of an UTF-8 sequence.
+typedef vector<pair<unsigned char, unsigned char> > Utf8Sequence;
+
+static unsigned int utf8_encode(unsigned int code, unsigned char* buf)
+{
+	if (code < 0x80)
+	{
+		buf[0] = (unsigned char)code;
+		return 1;
+	}
+	else if (code < 0x800)
+	{
+		buf[0] = (unsigned char)(0xC0 | (code >> 6));
+		buf[1] = (unsigned char)(0x80 | (code & 0x3F));
+		return 2;
+	}
+	else if (code < 0x10000)
+	{
+		buf[0] = (unsigned char)(0xE0 | (code >> 12));
+		buf[1] = (unsigned char)(0x80 | ((code >> 6) & 0x3F));
+		buf[2] = (unsigned char)(0x80 | (code & 0x3F));
+		return 3;
+	}
+	else
+	{
+		buf[0] = (unsigned char)(0xF0 | (code >> 18));
+		buf[1] = (unsigned char)(0x80 | ((code >> 12) & 0x3F));
+		buf[2] = (unsigned char)(0x80 | ((code >> 6) & 0x3F));
+		buf[3] = (unsigned char)(0x80 | (code & 0x3F));
+		return 4;
+	}
+}
+
+/* Split the code point range into the ranges that every byte of their
+ * UTF-8 sequences can be described by a byte range. */
+static void utf8_split(unsigned int min, unsigned int max, vector<Utf8Sequence>& out)
+{
+	if (min > max)
+		return;
+	// Surrogates can't be encoded.
+	if (min <= 0xDFFF && max >= 0xD800)
+	{
+		if (min < 0xD800)
+			utf8_split(min, 0xD7FF, out);
+		if (max > 0xDFFF)
+			utf8_split(0xE000, max, out);
+		return;
+	}
+	// Split by the length of sequence.
+	static const unsigned int limits[] = { 0x7F, 0x7FF, 0xFFFF };
+	for (unsigned int i = 0; i < 3; i++)
+	{
+		if (min <= limits[i] && max > limits[i])
+		{
+			utf8_split(min, limits[i], out);
+			utf8_split(limits[i] + 1, max, out);
+			return;
+		}
+	}
+	// Split until the trailing bytes cover either one value or all values.
+	for (unsigned int i = 1; i < 4; i++)
+	{
+		unsigned int mask = (1U << (6 * i)) - 1;
+		if ((min & ~mask) != (max & ~mask))
+		{
+			if ((min & mask) != 0)
+			{
+				utf8_split(min, min | mask, out);
+				utf8_split((min | mask) + 1, max, out);
+				return;
+			}
+			if ((max & mask) != mask)
+			{
+				utf8_split(min, (max & ~mask) - 1, out);
+				utf8_split(max & ~mask, max, out);
+				return;
+			}
+		}
+	}
+	unsigned char first[4], last[4];
+	unsigned int len = utf8_encode(min, first);
+	utf8_encode(max, last);
+	Utf8Sequence seq;
+	for (unsigned int i = 0; i < len; i++)
+		seq.push_back(make_pair(first[i], last[i]));
+	out.push_back(seq);
+}
+
+template <class T>
+static typename Exp<T>::ExpPtr utf8_range(ExpPool<T>& pool, const Range<wchar_t>& range)
+		throw (std::runtime_error)
+{
+	typedef typename Exp<T>::ExpPtr ExpPtr;
+	if (range.empty())
+		return pool.create(Range<T>::empty_range);
+
+	unsigned int min = (unsigned int)range.min();
+	unsigned int max = (unsigned int)range.max();
+	if (max > 0x10FFFF)
+		max = 0x10FFFF;
+	vector<Utf8Sequence> seqs;
+	utf8_split(min, max, seqs);
+	if (seqs.empty())
+		throw runtime_error("Character range can't be encoded as UTF-8.");
+
+	ExpPtr result = 0;
+	for (size_t i = 0; i < seqs.size(); i++)
+	{
+		ExpPtr seq = 0;
+		for (size_t j = 0; j < seqs[i].size(); j++)
+		{
+			// Bytes of a range are either all below 0x80 or all above,
+			// so the range keeps its order for the signed char.
+			ExpPtr byte = pool.create(Range<T>((T)seqs[i][j].first, (T)seqs[i][j].second));
+			seq = seq ? exp_join<T>(pool, seq, byte, RE_JOIN_AND) : byte;
+		}
+		result = result ? exp_join<T>(pool, result, seq, RE_JOIN_OR) : seq;
+	}
+	return result;
+}
+
+template <class T>
+typename Exp<T>::ExpPtr exp_utf8(ExpPool<T>& pool, Exp<wchar_t>::ExpPtr exp)
+		throw (std::runtime_error)
+{
+	typename Exp<T>::ExpPtr result;
+	if (exp->type == RE_NODE_RANGE)
+		result = utf8_range<T>(pool, exp->range);
+	else if (exp->type == RE_NODE_AND || exp->type == RE_NODE_OR)
+		result = pool.create(exp->type, exp_utf8<T>(pool, exp->exp.left),
+				exp_utf8<T>(pool, exp->exp.right));
+	else
+		result = pool.create(exp->type, exp_utf8<T>(pool, exp->child));
+	result->action = exp->action;
+	return result;
+}
+
+template Exp<char>::ExpPtr exp_utf8<char>(ExpPool<char>& pool,
+		Exp<wchar_t>::ExpPtr exp) throw (std::runtime_error);
+template Exp<unsigned char>::ExpPtr exp_utf8<unsigned char>(ExpPool<unsigned char>& pool,
+		Exp<wchar_t>::ExpPtr exp) throw (std::runtime_error);
+
 template class Exp<char>;
 template class Exp<unsigned char>;
 template class Exp<wchar_t>;
+template class ExpPool<char>;
+template class ExpPool<unsigned char>;
+template class ExpPool<wchar_t>;
 
 } // End of namespace lex
 } // End of namespace tlib
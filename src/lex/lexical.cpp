@@ -29,7 +29,19 @@
 #include <map>
 #include <set>
 #include <vector>
+#include <algorithm>
 #include "../tlibstr.h"
+#include "../../include/tlib/lock.h"
+#include "../../include/tlib/os.h"
+#include "../../include/tlib/encode.h"
+#include <cstdio>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define LEXICAL_SSE2
+#	include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+#	include <immintrin.h>
+#endif
 
 
 extern const unsigned char lex_name_bc[];
@@ -190,6 +202,9 @@ static bool format_key(basic_string<T>& key, bool& minimum, bool& ignore)
 #pragma pack(push)
 #pragma pack(4)
 
+/* Transit of the legacy (version 1) byte code, the table is a dense
+ * state_count * input_count matrix, it is only used to build and
+ * convert lexicals now. */
 typedef struct _dfa_transit
 {
 	bool final_state;
@@ -201,10 +216,12 @@ typedef struct _action_info
 {
 	bool minimum;
 	bool ignore;
+	// Characters of the name, it is not set in the legacy byte code.
+	unsigned short name_length;
 	unsigned int name_offset;
 } ActionInfo;
 
-typedef struct _dfa_data
+typedef struct _legacy_dfa_data
 {
 	unsigned int header_size;
 	unsigned int data_size;
@@ -218,8 +235,161 @@ typedef struct _dfa_data
 	unsigned int action_info_count;
 	unsigned int action_names_offset;
 	unsigned int action_names_size;
+} LegacyDfaData;
+
+// "TLEX"
+#define DFA_MAGIC 0x58454C54
+#define DFA_VERSION 5
+
+// Transition table layout.
+#define DFA_TABLE_DENSE 0
+#define DFA_TABLE_COMB 1
+
+// Flags of state.
+#define DFA_STATE_FINAL 1
+#define DFA_STATE_MINIMUM 2
+#define DFA_STATE_LOOP 4
+
+// Most bytes that can leave a loop state, include the NUL.
+#define DFA_STATE_EXITS 4
+
+/* Every state has the action that accepted when reach it. A loop state
+ * goes to itself by any byte except the "exits", so the scanner can skip
+ * the bytes without looking up the table. */
+typedef struct _dfa_state
+{
+	unsigned short action;
+	unsigned char flags;
+	unsigned char exit_count;
+	unsigned char exits[DFA_STATE_EXITS];
+} DfaState;
+
+/* Byte code of version 2. State id is stored in "state_size" bytes
+ * (1, 2 or 4), the id "state_count" means the dead state.
+ * A dense table is a state_count * input_count matrix of state ids.
+ * A comb table (row displacement) find the transit of (state, input)
+ * at "base[state] + input", it is valid only if "check" at the same
+ * index equals the state, otherwise look up the template row of
+ * "fallback[state]" in the same way, no template means the dead state. */
+typedef struct _dfa_data
+{
+	unsigned int magic;
+	unsigned int version;
+	unsigned int header_size;
+	unsigned int data_size;
+	unsigned int char_size;
+	unsigned int char_map_offset;
+	unsigned int char_map_count;
+	// Top index of the wide char map, 0 for the narrow char types.
+	unsigned int char_index_offset;
+	unsigned int state_count;
+	unsigned int input_count;
+	unsigned int state_size;
+	unsigned int state_info_offset;
+	unsigned int table_type;
+	unsigned int transit_offset;
+	unsigned int transit_count;
+	unsigned int base_offset;
+	unsigned int check_offset;
+	unsigned int fallback_offset;
+	unsigned int action_info_offset;
+	unsigned int action_info_count;
+	unsigned int action_names_offset;
+	unsigned int action_names_size;
 } DfaData;
 
+#pragma pack(pop)
+
+static std::string lexical_cache_dir;
+static Mutex lexical_cache_mutex;
+// Count of the temporary files written by this process.
+static unsigned long lexical_cache_temps = 0;
+
+void set_lexical_cache(const std::string& dir)
+{
+	Lock<Mutex> lock(lexical_cache_mutex);
+	lexical_cache_dir = dir;
+}
+
+std::string get_lexical_cache()
+{
+	Lock<Mutex> lock(lexical_cache_mutex);
+	return lexical_cache_dir;
+}
+
+/* Name of the character type in the cache key. */
+template <typename T>
+inline const char* cache_type();
+template <>
+inline const char* cache_type<char>()
+{
+	return "char";
+}
+template <>
+inline const char* cache_type<unsigned char>()
+{
+	return "uchar";
+}
+template <>
+inline const char* cache_type<wchar_t>()
+{
+	return "wchar";
+}
+
+/* Cache file of the definition, the name is the MD5 of the definition,
+ * the character types and the byte code version. Return an empty string
+ * if the cache is off. */
+template <typename T, typename C>
+std::string cache_file(const char* kind, const std::basic_string<C>& lexical)
+{
+	std::string dir = get_lexical_cache();
+	if (dir.empty())
+		return dir;
+	std::ostringstream head;
+	head << kind << cache_type<T>() << " " << sizeof(T) << " " << sizeof(C)
+		<< " " << DFA_VERSION << "\n";
+	binary key;
+	key << head.str();
+	const unsigned char* begin = (const unsigned char*)lexical.c_str();
+	key.insert(key.end(), begin, begin + lexical.length() * sizeof(C));
+	char last = dir[dir.length() - 1];
+	if (last != '/' && last != '\\')
+		dir += '/';
+	return dir + hex_str(hash::md5(key)) + ".bc";
+}
+
+/* Write the byte code to a temporary file then rename it, so another
+ * process never sees a partial file. Errors are ignored, the cache is
+ * only a shortcut. */
+inline void store_cache(const std::string& filename, const void* data)
+{
+	unsigned long serial;
+	{
+		Lock<Mutex> lock(lexical_cache_mutex);
+		serial = lexical_cache_temps++;
+	}
+	// The process id and the serial make the name unique.
+	std::ostringstream tmp;
+	tmp << filename << "." << get_process_id() << "." << serial << ".tmp";
+	{
+		ofstream out(tmp.str().c_str(), ios::out | ios::binary);
+		if (!out.good())
+			return;
+		out.write((const char*)data, ((const DfaData*)data)->data_size);
+		if (!out.good())
+		{
+			out.close();
+			std::remove(tmp.str().c_str());
+			return;
+		}
+	}
+	if (std::rename(tmp.str().c_str(), filename.c_str()) != 0)
+	{
+		std::remove(filename.c_str());
+		if (std::rename(tmp.str().c_str(), filename.c_str()) != 0)
+			std::remove(tmp.str().c_str());
+	}
+}
 
 template <typename T>
 class Define
@@ -232,19 +402,27 @@ public:
 	int line;
 };
 
-#pragma pack(pop)
-
 
 template <typename T>
-typename Lexical<T>::LexicalPtr Lexical<T>::create(const std::basic_string<T>& lexical)
+typename CompiledLexer<T>::CompiledLexerPtr CompiledLexer<T>::create(const std::basic_string<T>& lexical)
 		throw(std::runtime_error)
 {
+	std::string cache = cache_file<T>("", lexical);
+	if (!cache.empty())
+	{
+		CompiledLexerPtr lexer = create_by_cache(cache);
+		if (lexer)
+			return lexer;
+	}
 	basic_istringstream<T> in(lexical);
-	return create_by_stream(in);
+	CompiledLexerPtr lexer = create_by_stream(in);
+	if (!cache.empty())
+		store_cache(cache, lexer->_data);
+	return lexer;
 }
 
 template <>
-Lexical<char>::LexicalPtr Lexical<char>::create_by_file(const std::string& filename)
+CompiledLexer<char>::CompiledLexerPtr CompiledLexer<char>::create_by_file(const std::string& filename)
 		throw(std::runtime_error)
 {
 	std::string str;
@@ -253,7 +431,7 @@ Lexical<char>::LexicalPtr Lexical<char>::create_by_file(const std::string& filen
 }
 
 template <>
-Lexical<unsigned char>::LexicalPtr Lexical<unsigned char>::create_by_file(const std::string& filename)
+CompiledLexer<unsigned char>::CompiledLexerPtr CompiledLexer<unsigned char>::create_by_file(const std::string& filename)
 		throw(std::runtime_error)
 {
 	std::string str;
@@ -263,7 +441,7 @@ Lexical<unsigned char>::LexicalPtr Lexical<unsigned char>::create_by_file(const
 }
 
 template <>
-Lexical<wchar_t>::LexicalPtr Lexical<wchar_t>::create_by_file(const std::string& filename)
+CompiledLexer<wchar_t>::CompiledLexerPtr CompiledLexer<wchar_t>::create_by_file(const std::string& filename)
 		throw(std::runtime_error)
 {
 	std::wstring str;
@@ -321,6 +499,7 @@ bool string_compare<wchar_t>(const std::basic_string<wchar_t>& str1, const char*
 }
 
 
+/* Size of the flat char map, the legacy byte code stores it directly. */
 template <typename T> inline
 void init_size(unsigned int& char_size, unsigned int& char_map_count);
 template <> inline
@@ -342,47 +521,99 @@ void init_size<wchar_t>(unsigned int& char_size, unsigned int& char_map_count)
 	char_map_count = 65536;
 }
 
+/* Map every character to the input id, the characters not in any range
+ * are mapped to the last input which has no transit. */
 template <typename T> inline
-void init_char_map(DfaData* dfa_data, Dfa<T>& dfa);
-
-template <> inline
-void init_char_map<char>(DfaData* dfa_data, Dfa<char>& dfa)
+void init_char_map(std::vector<unsigned short>& char_map,
+		const typename Dfa<T>::RangeVector& range_map)
 {
-	unsigned short* char_array = (unsigned short*)((char*)dfa_data + dfa_data->char_map_offset);
-	for (unsigned int i = 0; i < 256; i++)
-		char_array[i] = (unsigned short)dfa.range_map.size();
-	for (unsigned int i = 0; i < dfa.range_map.size(); i++)
+	unsigned int count = (unsigned int)((int)Range<T>::full_max - (int)Range<T>::full_min) + 1;
+	char_map.assign(count, (unsigned short)range_map.size());
+	for (unsigned int i = 0; i < range_map.size(); i++)
 	{
-		for (int ch = dfa.range_map[i].min(); ch <= dfa.range_map[i].max(); ++ch)
-			char_array[ch + 128] = (unsigned short)i;
+		for (int ch = range_map[i].min(); ch <= range_map[i].max(); ++ch)
+			char_map[ch - (int)Range<T>::full_min] = (unsigned short)i;
 	}
 }
 
-template <> inline
-void init_char_map<unsigned char>(DfaData* dfa_data, Dfa<unsigned char>& dfa)
+/* The wide char map is a trie: the top index is selected by the bits
+ * above CHAR_MID_SHIFT, it holds the id of a middle block, the middle
+ * block is selected by the next CHAR_MID_BITS bits and holds the id of
+ * a leaf block, the leaf block maps the low CHAR_LEAF_BITS bits to the
+ * input id. The same blocks are stored only once, and the leaf block 0
+ * is always the Latin-1 block, so it can be looked up directly. */
+#define CHAR_LEAF_BITS 8
+#define CHAR_MID_BITS 4
+#define CHAR_MID_SHIFT (CHAR_LEAF_BITS + CHAR_MID_BITS)
+#define CHAR_LEAF_SIZE (1 << CHAR_LEAF_BITS)
+#define CHAR_MID_SIZE (1 << CHAR_MID_BITS)
+#define CHAR_MAX_CODE 0x10FFFF
+#define CHAR_TOP_SIZE ((CHAR_MAX_CODE >> CHAR_MID_SHIFT) + 1)
+
+template <typename T>
+class CharMap;
+
+template <>
+class CharMap<char>
 {
-	unsigned short* char_array = (unsigned short*)((char*)dfa_data + dfa_data->char_map_offset);
-	for (unsigned int i = 0; i < 256; i++)
-		char_array[i] = (unsigned short)dfa.range_map.size();
-	for (unsigned int i = 0; i < dfa.range_map.size(); i++)
+public:
+	inline CharMap(const DfaData* data)
+	: _map((const unsigned short*)((const char*)data + data->char_map_offset))
 	{
-		for (int ch = dfa.range_map[i].min(); ch <= dfa.range_map[i].max(); ++ch)
-			char_array[ch] = (unsigned short)i;
 	}
-}
+	inline unsigned short map(char ch) const
+	{
+		return _map[((int)ch) + 128];
+	}
+private:
+	const unsigned short* _map;
+};
 
-template <> inline
-void init_char_map<wchar_t>(DfaData* dfa_data, Dfa<wchar_t>& dfa)
+template <>
+class CharMap<unsigned char>
 {
-	unsigned short* char_array = (unsigned short*)((char*)dfa_data + dfa_data->char_map_offset);
-	for (unsigned int i = 0; i < 65536; i++)
-		char_array[i] = (unsigned short)dfa.range_map.size();
-	for (unsigned int i = 0; i < dfa.range_map.size(); i++)
+public:
+	inline CharMap(const DfaData* data)
+	: _map((const unsigned short*)((const char*)data + data->char_map_offset))
 	{
-		for (int ch = dfa.range_map[i].min(); ch <= dfa.range_map[i].max(); ++ch)
-			char_array[ch] = (unsigned short)i;
 	}
-}
+	inline unsigned short map(unsigned char ch) const
+	{
+		return _map[(int)ch];
+	}
+private:
+	const unsigned short* _map;
+};
+
+template <>
+class CharMap<wchar_t>
+{
+public:
+	inline CharMap(const DfaData* data)
+	: _leaves((const unsigned short*)((const char*)data + data->char_map_offset)),
+	  _top((const unsigned short*)((const char*)data + data->char_index_offset)),
+	  _mids(_top + CHAR_TOP_SIZE),
+	  _other((unsigned short)(data->input_count - 1))
+	{
+	}
+	inline unsigned short map(wchar_t ch) const
+	{
+		unsigned int code = (unsigned int)ch;
+		if (code < CHAR_LEAF_SIZE)
+			return _leaves[code];
+		if (code > CHAR_MAX_CODE)
+			return _other;
+		unsigned int mid = _top[code >> CHAR_MID_SHIFT];
+		unsigned int leaf = _mids[(mid << CHAR_MID_BITS)
+				| ((code >> CHAR_LEAF_BITS) & (CHAR_MID_SIZE - 1))];
+		return _leaves[(leaf << CHAR_LEAF_BITS) | (code & (CHAR_LEAF_SIZE - 1))];
+	}
+private:
+	const unsigned short* _leaves;
+	const unsigned short* _top;
+	const unsigned short* _mids;
+	const unsigned short _other;
+};
 
 
 #ifdef __MSVC__
@@ -498,15 +729,13 @@ const std::basic_string<T> replace_macro(
 
 	typedef std::map<std::basic_string<T>, std::basic_string<T> > ReplMap;
 
-	std::basic_istringstream<T> ss(source);
-	exp._lexical->parse(ss);
+	exp._lexical->parse(source.c_str(), source.length());
 	Token<T> token;
 	while (exp._lexical->fetch_next(token))
 	{
 		if (token.action == 1)
 		{
-			std::basic_string<T> key_name =
-					token.str.substr(1, token.str.length() - 2);
+			std::basic_string<T> key_name(token.data + 1, token.length - 2);
 
 			if (repl_keys.find(key_name) != repl_keys.end())
 				throw runtime_error("Recursive definition: " + to_string<T>(key_name));
@@ -519,622 +748,3521 @@ const std::basic_string<T> replace_macro(
 				repl_keys.erase(key_name);
 			}
 			else
-				result += token.str;
+				result.append(token.data, token.length);
 		}
 		else
-			result += token.str;
+			result.append(token.data, token.length);
 	}
 	return result;
 }
 
 
-template <typename T>
-typename Lexical<T>::LexicalPtr Lexical<T>::create_by_stream(std::basic_istream<T>& in)
-		throw(std::runtime_error)
+/* Read the state id of transit from a dense table. */
+template <typename S>
+class DenseTable
 {
-	typedef std::vector<Define<T> > Defines;
-	Defines defines;
-	Define<T> define_error;
-	error_define<T>(define_error);
-	defines.push_back(define_error);
+public:
+	inline DenseTable(const DfaData* data)
+	: dead(data->state_count),
+	  _transit((const S*)((const char*)data + data->transit_offset)),
+	  _states((const DfaState*)((const char*)data + data->state_info_offset)),
+	  _input_count(data->input_count)
+	{
+	}
+	inline unsigned int next(unsigned int state, unsigned int in) const
+	{
+		return _transit[state * _input_count + in];
+	}
+	inline const DfaState& state(unsigned int state) const
+	{
+		return _states[state];
+	}
+	const unsigned int dead;
+private:
+	const S* _transit;
+	const DfaState* _states;
+	const unsigned int _input_count;
+};
 
-	// Used for replace defined macro token
-	typedef std::map<std::basic_string<T>, std::basic_string<T> > Repls;
-	Repls repls;
+/* Read the state id of transit from a comb table. */
+template <typename S>
+class CombTable
+{
+public:
+	inline CombTable(const DfaData* data)
+	: dead(data->state_count),
+	  _transit((const S*)((const char*)data + data->transit_offset)),
+	  _check((const S*)((const char*)data + data->check_offset)),
+	  _fallback((const S*)((const char*)data + data->fallback_offset)),
+	  _base((const unsigned int*)((const char*)data + data->base_offset)),
+	  _states((const DfaState*)((const char*)data + data->state_info_offset))
+	{
+	}
+	inline unsigned int next(unsigned int state, unsigned int in) const
+	{
+		unsigned int idx = _base[state] + in;
+		if (_check[idx] == state)
+			return _transit[idx];
+		state = _fallback[state];
+		if (state == dead)
+			return dead;
+		idx = _base[state] + in;
+		if (_check[idx] == state)
+			return _transit[idx];
+		return dead;
+	}
+	inline const DfaState& state(unsigned int state) const
+	{
+		return _states[state];
+	}
+	const unsigned int dead;
+private:
+	const S* _transit;
+	const S* _check;
+	const S* _fallback;
+	const unsigned int* _base;
+	const DfaState* _states;
+};
 
-	basic_string<T> line;
-	int line_count = 0;
-	// Whether is the line is extended line.
-	bool is_continue = false;
-	while (in.good())
+/* Call 'op' with the table policy that matches the byte code, so the
+ * scan loop is compiled for every table layout and state size. */
+template <typename Op>
+inline void dispatch_table(const DfaData* data, Op& op)
+{
+	if (data->table_type == DFA_TABLE_COMB)
 	{
-		getline(in, line, (T)'\n');
-		line_count++;
-		// The line continue to the above line.
-		if (_isspace(line[0]))
-			is_continue = true;
+		if (data->state_size == 1)
+			op(CombTable<unsigned char>(data));
+		else if (data->state_size == 2)
+			op(CombTable<unsigned short>(data));
 		else
-			is_continue = false;
+			op(CombTable<unsigned int>(data));
+	}
+	else
+	{
+		if (data->state_size == 1)
+			op(DenseTable<unsigned char>(data));
+		else if (data->state_size == 2)
+			op(DenseTable<unsigned short>(data));
+		else
+			op(DenseTable<unsigned int>(data));
+	}
+}
 
-		trim(line);
-		if (line.empty())
-			continue;
-		if (line[0] == '#')
-		{
-			if (line.length() > 2 && line[1] == '!')
-			{
-				// Define replace macro line
-				line = line.substr(2);
-				size_t find_pos = line.find(':', 0);
-				if (find_pos != string::npos)
-				{
-					basic_string<T> name = line.substr(0, find_pos);
-					trim(name);
-					if (!is_key_name(name))
-						continue;
-					basic_string<T> value = line.substr(find_pos + 1);
-					trim(value);
-					repls[name] = value;
-				}
-			}
-			continue;
-		}
+// The transit of a lazy DFA state that is not built yet.
+#define LAZY_UNKNOWN 0xfffffffeU
+#define LAZY_DEAD 0xffffffffU
 
-		// Follow the previous line.
-		if (is_continue)
-		{
-			if (defines.size() > 1)
-			{
-				defines.back().value += line;
-			}
-			else
-			{
-				stringstream sbuf;
-				sbuf << "Syntax error: line " << line_count
-						<< ": does not yet have any lines can be extended.";
-				throw runtime_error(sbuf.str().c_str());
-			}
-			continue;
-		}
+/* The position automaton of a lazy lexical, it is shared by the scanners. */
+template <typename T>
+class LazyDfa
+{
+public:
+	Nfa<T> nfa;
+	// The minimum flag of every action.
+	std::vector<bool> minimum;
+	unsigned int input_count;
+	unsigned long cache_size;
+};
 
-		// Start a new define line.
-		size_t find_pos = line.find(':', 0);
-		if (find_pos == string::npos)
-		{
-			stringstream sbuf;
-			sbuf << "Syntax error: line " << line_count
-					<< ": must in [NAME]<:><VALUE> format";
-			throw runtime_error(sbuf.str().c_str());
-		}
+/* The DFA states that a scanner has met, a state is keyed by the accepted
+ * action + 1 (0 if not final) and its sorted positions. The transits are
+ * built when they are first used, all states are dropped when the cache
+ * is over the size limit, then it is filled again from the current state. */
+template <typename T>
+class LazyCache
+{
+public:
+	explicit LazyCache(const LazyDfa<T>& dfa);
+	inline unsigned int next(unsigned int state, unsigned int in)
+	{
+		unsigned int to = _transits[state * _input_count + in];
+		if (to == LAZY_UNKNOWN)
+			to = build(state, in);
+		return to;
+	}
+	inline const DfaState& state(unsigned int state) const
+	{
+		return _states[state];
+	}
+private:
+	unsigned int build(unsigned int state, unsigned int in);
+	unsigned int add(const std::vector<unsigned int>& key);
+	void flush();
+	inline unsigned long size() const
+	{
+		return (unsigned long)_transits.size() * sizeof(unsigned int)
+				+ (unsigned long)_states.size() * (sizeof(DfaState) + 4 * sizeof(unsigned int))
+				+ (unsigned long)_sets.positions() * sizeof(unsigned int);
+	}
+	const LazyDfa<T>& _dfa;
+	const unsigned int _input_count;
+	StateSets _sets;
+	std::vector<DfaState> _states;
+	std::vector<unsigned int> _transits;
+	std::vector<unsigned int> _key;
+	std::vector<unsigned int> _target;
+	// Bitset to drop the repeated follow positions.
+	std::vector<unsigned int> _seen;
+};
 
-		basic_string<T> name = line.substr(0, find_pos);
-		bool minimum = false;
-		bool ignore = false;
-		if (!format_key(name, minimum, ignore))
-		{
-			stringstream sbuf;
-			sbuf << "Syntax error: line " << line_count
-					<< ": invalid token name.";
-			throw runtime_error(sbuf.str().c_str());
-		}
+template <typename T>
+LazyCache<T>::LazyCache(const LazyDfa<T>& dfa)
+: _dfa(dfa), _input_count(dfa.input_count),
+  _seen((dfa.nfa.actions.size() + 31) / 32, 0)
+{
+	flush();
+}
 
-		basic_string<T> value = line.substr(find_pos + 1);
-		trim(value);
-		if (value.empty() && !string_compare(name, "error"))
-		{
-			stringstream sbuf;
-			sbuf << "Syntax error: line " << line_count
-					<< ": expression can't be empty.";
-			throw runtime_error(sbuf.str().c_str());
-		}
+template <typename T>
+void LazyCache<T>::flush()
+{
+	_sets.clear();
+	_states.clear();
+	_transits.clear();
+	// The start state is always 0.
+	std::vector<unsigned int> start(1, 0);
+	start.insert(start.end(), _dfa.nfa.first.begin(), _dfa.nfa.first.end());
+	add(start);
+}
 
-		if (!string_compare(name, "error"))
+template <typename T>
+unsigned int LazyCache<T>::add(const std::vector<unsigned int>& key)
+{
+	unsigned int id = _sets.find_or_add(key);
+	if (id < _states.size())
+		return id;
+	DfaState state;
+	memset(&state, 0, sizeof(DfaState));
+	if (key[0] != 0)
+	{
+		state.action = (unsigned short)(key[0] - 1);
+		state.flags = DFA_STATE_FINAL;
+		if (_dfa.minimum[state.action])
+			state.flags |= DFA_STATE_MINIMUM;
+	}
+	_states.push_back(state);
+	_transits.resize(_transits.size() + _input_count, LAZY_UNKNOWN);
+	return id;
+}
+
+/* Build the transit like make_dfa() and split_states() do for one state. */
+template <typename T>
+unsigned int LazyCache<T>::build(unsigned int state, unsigned int in)
+{
+	const Nfa<T>& nfa = _dfa.nfa;
+	_key.assign(_sets.begin(state), _sets.end(state));
+	Action action = 0;
+	_target.assign(1, 0);
+	for (unsigned int k = 1; k < _key.size(); k++)
+	{
+		unsigned int pos = _key[k];
+		if (in < nfa.cover_begin[pos] || in >= nfa.cover_end[pos])
+			continue;
+		// The first definition has a higher priority.
+		if (action == 0)
+			action = nfa.actions[pos];
+		for (unsigned int f = nfa.follow_begin[pos]; f < nfa.follow_begin[pos + 1]; f++)
 		{
-			Define<T> define =
-			{ name, value, minimum, ignore, line_count};
-			defines.push_back(define);
+			unsigned int follow = nfa.follows[f];
+			unsigned int bit = 1U << (follow & 31);
+			if (_seen[follow >> 5] & bit)
+				continue;
+			_seen[follow >> 5] |= bit;
+			_target.push_back(follow);
 		}
-		else
-			defines[0].ignore = ignore;
 	}
+	for (unsigned int k = 1; k < _target.size(); k++)
+		_seen[_target[k] >> 5] = 0;
+	if (_target.size() == 1)
+	{
+		_transits[state * _input_count + in] = LAZY_DEAD;
+		return LAZY_DEAD;
+	}
+	std::sort(_target.begin() + 1, _target.end());
+	if (std::binary_search(_target.begin() + 1, _target.end(), nfa.finished_id))
+		_target[0] = action + 1;
 
-
-	//LexRepl<T> repl(defines);
-	// Create expression tree
-	typename Exp<T>::ExpPtr exp;
-	for (size_t i = 1; i < defines.size(); i++)
+	if (size() > _dfa.cache_size)
 	{
-		typename Exp<T>::ExpPtr tmp_exp;
-		try
-		{
-			// asm("INT $3");
-			// Replace {name} with a real regex.
-			std::set<basic_string<T> > repl_keys;
-			defines[i].value = replace_macro<T>(defines[i].value, repls, repl_keys);
+		flush();
+		state = add(_key);
+	}
+	unsigned int to = add(_target);
+	_transits[state * _input_count + in] = to;
+	return to;
+}
 
-			tmp_exp = exp_parse(defines[i].value.c_str());
+/* Read the state id of transit from the states a scanner has built. */
+template <typename T>
+class LazyTable
+{
+public:
+	inline LazyTable(LazyCache<T>* cache)
+	: dead(LAZY_DEAD), _cache(cache)
+	{
+	}
+	inline unsigned int next(unsigned int state, unsigned int in) const
+	{
+		return _cache->next(state, in);
+	}
+	inline const DfaState& state(unsigned int state) const
+	{
+		return _cache->state(state);
+	}
+	const unsigned int dead;
+private:
+	LazyCache<T>* _cache;
+};
+
+/* Call 'op' with the lazy table if the scanner has the cache, otherwise
+ * with the table of the byte code. */
+template <typename T, typename Op>
+inline void dispatch_scan(const DfaData* data, LazyCache<T>* cache, Op& op)
+{
+	if (cache)
+		op(LazyTable<T>(cache));
+	else
+		dispatch_table(data, op);
+}
+
+// Size limit of the unanchored automaton of a scanner.
+#define LEXICAL_SEARCH_CACHE_SIZE (1UL << 20)
+// Longest literal prefix used to filter the search positions.
+#define LEXICAL_SEARCH_PREFIX 16
+
+/* The unanchored automaton of search(), a state is the set of the lexical
+ * states reached by the tokens begun before the current character, keyed
+ * by the final flag (1 if one of them has an action) and the sorted state
+ * ids. The state 0 is the empty set, nothing is in flight there. It is
+ * built lazily and dropped when full like LazyCache. */
+class SearchCache
+{
+public:
+	explicit SearchCache(unsigned int input_count);
+	template <typename Table>
+	inline unsigned int next(const Table& table, unsigned int state, unsigned int in)
+	{
+		unsigned int to = _transits[state * _input_count + in];
+		if (to == LAZY_UNKNOWN)
+			to = build(table, state, in);
+		return to;
+	}
+	inline bool final(unsigned int state) const
+	{
+		return _final[state] != 0;
+	}
+	// The bytes that can begin a token and the NUL, in the exits of a
+	// loop state to be found by find_exit(), no exit if there are too many.
+	DfaState first;
+	// The literal that every token begins with, if any.
+	std::string prefix;
+private:
+	template <typename Table>
+	unsigned int build(const Table& table, unsigned int state, unsigned int in);
+	unsigned int add(const std::vector<unsigned int>& key);
+	void flush();
+	inline unsigned long size() const
+	{
+		return (unsigned long)_transits.size() * sizeof(unsigned int)
+				+ (unsigned long)_final.size() * (1 + 4 * sizeof(unsigned int))
+				+ (unsigned long)_sets.positions() * sizeof(unsigned int);
+	}
+	const unsigned int _input_count;
+	StateSets _sets;
+	std::vector<unsigned char> _final;
+	std::vector<unsigned int> _transits;
+	std::vector<unsigned int> _key;
+	std::vector<unsigned int> _target;
+};
+
+SearchCache::SearchCache(unsigned int input_count)
+: _input_count(input_count)
+{
+	memset(&first, 0, sizeof(DfaState));
+	flush();
+}
+
+void SearchCache::flush()
+{
+	_sets.clear();
+	_final.clear();
+	_transits.clear();
+	add(std::vector<unsigned int>(1, 0));
+}
+
+unsigned int SearchCache::add(const std::vector<unsigned int>& key)
+{
+	unsigned int id = _sets.find_or_add(key);
+	if (id < _final.size())
+		return id;
+	_final.push_back((unsigned char)key[0]);
+	_transits.resize(_transits.size() + _input_count, LAZY_UNKNOWN);
+	return id;
+}
+
+/* Move every state of the set and a new token from the start state. */
+template <typename Table>
+unsigned int SearchCache::build(const Table& table, unsigned int state, unsigned int in)
+{
+	_key.assign(_sets.begin(state), _sets.end(state));
+	_target.assign(1, 0);
+	for (unsigned int k = 0; k < _key.size(); k++)
+	{
+		// _key[0] is the flag, take it as the start state.
+		unsigned int next = table.next(k == 0 ? 0 : _key[k], in);
+		if (next == table.dead)
+			continue;
+		const DfaState& s = table.state(next);
+		if ((s.flags & DFA_STATE_FINAL) && s.action != 0)
+			_target[0] = 1;
+		_target.push_back(next);
+	}
+	std::sort(_target.begin() + 1, _target.end());
+	_target.erase(std::unique(_target.begin() + 1, _target.end()), _target.end());
+
+	if (size() > LEXICAL_SEARCH_CACHE_SIZE)
+	{
+		flush();
+		state = add(_key);
+	}
+	unsigned int to = add(_target);
+	_transits[state * _input_count + in] = to;
+	return to;
+}
+
+/* Find the bytes that can begin a token and the literal prefix of the
+ * tokens from the start state of the table, only for the byte lexicals. */
+template <typename T>
+class FindPrefilter
+{
+public:
+	inline FindPrefilter(const DfaData* data, SearchCache& search)
+	: _data(data), _search(search)
+	{
+	}
+	template <typename Table>
+	void operator () (const Table& table)
+	{
+		CharMap<T> char_map(_data);
+		DfaState& first = _search.first;
+		unsigned int count = 1;
+		first.exits[0] = 0;
+		for (unsigned int b = 1; b < 256 && count <= DFA_STATE_EXITS; b++)
+		{
+			if (table.next(0, char_map.map((T)b)) == table.dead)
+				continue;
+			if (count < DFA_STATE_EXITS)
+				first.exits[count] = (unsigned char)b;
+			count++;
 		}
-		catch (const std::exception& err)
+		if (count > DFA_STATE_EXITS)
+			return;
+		first.exit_count = (unsigned char)count;
+		if (count != 2)
+			return;
+		// Follow the states that have only one way out.
+		unsigned int state = 0;
+		unsigned int out = first.exits[1];
+		while (_search.prefix.length() < LEXICAL_SEARCH_PREFIX)
 		{
-			stringstream sbuf;
-			sbuf << "Syntax error: line " << defines[i].line << ": " << err.what();
-			throw runtime_error(sbuf.str().c_str());
+			_search.prefix += (char)out;
+			state = table.next(state, char_map.map((T)out));
+			if (table.state(state).flags & DFA_STATE_FINAL)
+				break;
+			unsigned int outs = 0;
+			for (unsigned int b = 1; b < 256 && outs < 2; b++)
+			{
+				if (table.next(state, char_map.map((T)b)) == table.dead)
+					continue;
+				out = b;
+				outs++;
+			}
+			if (outs != 1)
+				break;
 		}
-		tmp_exp->action = (Action)i;
-		if (exp)
-			exp = exp_join<T>(exp, tmp_exp, RE_JOIN_OR);
-		else
-			exp = tmp_exp;
 	}
+private:
+	const DfaData* _data;
+	SearchCache& _search;
+};
 
-	// Create DFA
-	Dfa<T> dfa;
-	if (exp)
+template <>
+class FindPrefilter<wchar_t>
+{
+public:
+	inline FindPrefilter(const DfaData* /*data*/, SearchCache& /*search*/)
 	{
-		make_dfa(exp, dfa);
 	}
-	else
-		throw runtime_error("No define any words.");
+	template <typename Table>
+	inline void operator () (const Table& /*table*/)
+	{
+	}
+};
 
-	DfaData header;
-	header.header_size = sizeof(DfaData);
+/* The DFA of a RegexSet, a state is keyed by the count and the actions of
+ * the patterns that end at the character entering it, then its sorted
+ * positions. The positions of the start state are added to every state so
+ * a match can begin anywhere. It is built lazily like LazyCache. */
+template <typename T>
+class SetCache
+{
+public:
+	explicit SetCache(const LazyDfa<T>& dfa);
+	inline unsigned int next(unsigned int state, unsigned int in)
+	{
+		unsigned int to = _transits[state * _input_count + in];
+		if (to == LAZY_UNKNOWN)
+			to = build(state, in);
+		return to;
+	}
+	// The actions matched when entering the state, only valid until the
+	// next call of next().
+	inline const unsigned int* matches_begin(unsigned int state) const
+	{
+		return _sets.begin(state) + 1;
+	}
+	inline const unsigned int* matches_end(unsigned int state) const
+	{
+		return _sets.begin(state) + 1 + *_sets.begin(state);
+	}
+private:
+	unsigned int build(unsigned int state, unsigned int in);
+	inline unsigned int add(const std::vector<unsigned int>& key);
+	void flush();
+	inline unsigned long size() const
+	{
+		return (unsigned long)_transits.size() * sizeof(unsigned int)
+				+ (unsigned long)_sets.size() * 4 * sizeof(unsigned int)
+				+ (unsigned long)_sets.positions() * sizeof(unsigned int);
+	}
+	const LazyDfa<T>& _dfa;
+	const unsigned int _input_count;
+	StateSets _sets;
+	std::vector<unsigned int> _transits;
+	std::vector<unsigned int> _key;
+	std::vector<unsigned int> _target;
+	std::vector<unsigned int> _actions;
+	// Bitset to drop the repeated follow positions.
+	std::vector<unsigned int> _seen;
+};
 
-	header.char_map_offset = header.header_size;
-	init_size<T>(header.char_size, header.char_map_count);
+template <typename T>
+SetCache<T>::SetCache(const LazyDfa<T>& dfa)
+: _dfa(dfa), _input_count(dfa.input_count),
+  _seen((dfa.nfa.actions.size() + 31) / 32, 0)
+{
+	flush();
+}
 
-	header.transit_map_offset = header.char_map_offset
-		+ header.char_size * header.char_map_count;
-	header.transit_map_state_count = dfa.total_states;
-	header.transit_map_input_count = (unsigned int)dfa.range_map.size() + 1;
+template <typename T>
+void SetCache<T>::flush()
+{
+	const Nfa<T>& nfa = _dfa.nfa;
+	_sets.clear();
+	_transits.clear();
+	// The start state is always 0, an empty match is not counted.
+	std::vector<unsigned int> start(1, 0);
+	for (unsigned int k = 0; k < nfa.first.size(); k++)
+	{
+		if (nfa.first[k] != nfa.finished_id)
+			start.push_back(nfa.first[k]);
+	}
+	add(start);
+}
 
-	header.action_info_offset = header.transit_map_offset
-		+ header.transit_map_state_count * header.transit_map_input_count
-		* sizeof(DfaTransit);
-	header.action_info_count = (unsigned int)defines.size();
+template <typename T> inline
+unsigned int SetCache<T>::add(const std::vector<unsigned int>& key)
+{
+	unsigned int id = _sets.find_or_add(key);
+	if ((unsigned long)id * _input_count >= _transits.size())
+		_transits.resize(_transits.size() + _input_count, LAZY_UNKNOWN);
+	return id;
+}
 
-	header.action_names_offset = header.action_info_offset
-		+ header.action_info_count * sizeof(ActionInfo);
-	header.action_names_size = 0;
-	for (unsigned int i = 0; i < defines.size(); i++)
+/* Only the last positions of a pattern have its action, a pattern ends
+ * when one of them reads the input. */
+template <typename T>
+unsigned int SetCache<T>::build(unsigned int state, unsigned int in)
+{
+	const Nfa<T>& nfa = _dfa.nfa;
+	_key.assign(_sets.begin(state), _sets.end(state));
+	_actions.clear();
+	_target.clear();
+	for (unsigned int k = 1 + _key[0]; k < _key.size(); k++)
 	{
-		header.action_names_size += (unsigned int)((defines[i].name.length() + 1) * sizeof(T));
+		unsigned int pos = _key[k];
+		if (in < nfa.cover_begin[pos] || in >= nfa.cover_end[pos])
+			continue;
+		if (nfa.actions[pos] != 0)
+			_actions.push_back(nfa.actions[pos]);
+		for (unsigned int f = nfa.follow_begin[pos]; f < nfa.follow_begin[pos + 1]; f++)
+		{
+			unsigned int follow = nfa.follows[f];
+			unsigned int bit = 1U << (follow & 31);
+			if (follow == nfa.finished_id || (_seen[follow >> 5] & bit))
+				continue;
+			_seen[follow >> 5] |= bit;
+			_target.push_back(follow);
+		}
 	}
-	header.data_size = header.action_names_offset + header.action_names_size;
-
-	LexicalPtr lexical(new Lexical());
-	lexical->_data = malloc(header.data_size);
-	if (!lexical->_data)
+	// The start positions are the tail of the start state.
+	const unsigned int* start = _sets.begin(0) + 1;
+	for (; start != _sets.end(0); start++)
 	{
-		throw runtime_error("Out of memory.");
+		unsigned int bit = 1U << (*start & 31);
+		if (_seen[*start >> 5] & bit)
+			continue;
+		_seen[*start >> 5] |= bit;
+		_target.push_back(*start);
 	}
-	lexical->_allocated = true;
-	DfaData* dfa_data = (DfaData*)lexical->_data;
-	memcpy(dfa_data, &header, sizeof(DfaData));
+	for (unsigned int k = 0; k < _target.size(); k++)
+		_seen[_target[k] >> 5] = 0;
+	std::sort(_target.begin(), _target.end());
+	std::sort(_actions.begin(), _actions.end());
+	_actions.erase(std::unique(_actions.begin(), _actions.end()), _actions.end());
+	_target.insert(_target.begin(), _actions.begin(), _actions.end());
+	_target.insert(_target.begin(), (unsigned int)_actions.size());
+
+	if (size() > _dfa.cache_size)
+	{
+		flush();
+		state = add(_key);
+	}
+	unsigned int to = add(_target);
+	_transits[state * _input_count + in] = to;
+	return to;
+}
 
-	// Initialize char map.
-	init_char_map(dfa_data, dfa);
+/* Uncompressed lexical tables, used to build the byte code. */
+template <typename T>
+struct DfaTables
+{
+	std::vector<unsigned short> char_map;
+	// Where the top index begin in "char_map", only for the wide char.
+	unsigned int char_index;
+	unsigned int input_count;
+	// state_count * input_count, "state_count" means the dead state.
+	std::vector<unsigned int> transits;
+	std::vector<DfaState> states;
+	std::vector<ActionInfo> actions;
+	std::vector<basic_string<T> > names;
+};
+
+/* Store the flat char map of 'count' characters, for the wide char
+ * build the trie, the characters beyond 'count' have no transit. */
+template <typename T>
+void pack_char_map(const unsigned short* char_map, unsigned int count,
+		DfaTables<T>& tables)
+{
+	tables.char_map.assign(char_map, char_map + count);
+	tables.char_index = 0;
+}
 
-	// Initialize transit map
-	DfaTransit *transit = (DfaTransit*)((char*)dfa_data + dfa_data->transit_map_offset);
-	for (unsigned int i = 0; i < dfa.total_states; i++)
+template <>
+void pack_char_map<wchar_t>(const unsigned short* char_map, unsigned int count,
+		DfaTables<wchar_t>& tables)
+{
+	typedef std::vector<unsigned short> Block;
+	typedef std::map<Block, unsigned short> BlockMap;
+	unsigned short other = (unsigned short)(tables.input_count - 1);
+	BlockMap leaf_map, mid_map;
+	std::vector<Block> leaves, mids;
+	Block top(CHAR_TOP_SIZE);
+	for (unsigned int i = 0; i < CHAR_TOP_SIZE; i++)
 	{
-		for (unsigned int j = 0; j < dfa_data->transit_map_input_count; j++)
+		Block mid(CHAR_MID_SIZE);
+		for (unsigned int j = 0; j < CHAR_MID_SIZE; j++)
+		{
+			unsigned int first = ((i << CHAR_MID_BITS) | j) << CHAR_LEAF_BITS;
+			Block leaf(CHAR_LEAF_SIZE, other);
+			for (unsigned int k = 0; k < CHAR_LEAF_SIZE && first + k < count; k++)
+				leaf[k] = char_map[first + k];
+			typename BlockMap::iterator it = leaf_map.find(leaf);
+			if (it == leaf_map.end())
+			{
+				it = leaf_map.insert(std::make_pair(leaf, (unsigned short)leaves.size())).first;
+				leaves.push_back(leaf);
+			}
+			mid[j] = it->second;
+		}
+		typename BlockMap::iterator it = mid_map.find(mid);
+		if (it == mid_map.end())
 		{
-			unsigned int idx = i * dfa_data->transit_map_input_count + j;
-			transit[idx].final_state = false;
-			transit[idx].state = dfa.total_states;
-			transit[idx].action = 0;
+			it = mid_map.insert(std::make_pair(mid, (unsigned short)mids.size())).first;
+			mids.push_back(mid);
 		}
+		top[i] = it->second;
 	}
-	for (unsigned int i = 0; i < dfa.transits.size(); i++)
+	tables.char_map.clear();
+	for (unsigned int i = 0; i < leaves.size(); i++)
+		tables.char_map.insert(tables.char_map.end(), leaves[i].begin(), leaves[i].end());
+	tables.char_index = (unsigned int)tables.char_map.size();
+	tables.char_map.insert(tables.char_map.end(), top.begin(), top.end());
+	for (unsigned int i = 0; i < mids.size(); i++)
+		tables.char_map.insert(tables.char_map.end(), mids[i].begin(), mids[i].end());
+}
+
+/* Blocks of equivalent states for the Hopcroft minimization, the states
+ * of a block are kept together in "elements", the marked ones first. */
+struct StatePartition
+{
+	std::vector<unsigned int> elements;
+	std::vector<unsigned int> location;
+	std::vector<unsigned int> block;
+	std::vector<unsigned int> first;
+	std::vector<unsigned int> mid;
+	std::vector<unsigned int> end;
+	std::vector<unsigned int> touched;
+
+	inline void mark(unsigned int state)
 	{
-		unsigned int idx = dfa.transits[i].from * dfa_data->transit_map_input_count
-				+ dfa.transits[i].input;
+		unsigned int b = block[state];
+		unsigned int i = location[state];
+		unsigned int j = mid[b];
+		if (i < j)
+			return;
+		if (j == first[b])
+			touched.push_back(b);
+		elements[i] = elements[j];
+		location[elements[i]] = i;
+		elements[j] = state;
+		location[state] = j;
+		mid[b]++;
+	}
+};
 
-		transit[idx].state = dfa.transits[i].to;
-		transit[idx].final_state = false;
-		transit[idx].action = 0;
-		for (unsigned int j = 0; j < dfa.accepting_states.size(); j++)
+/* Merge the equivalent states by the Hopcroft algorithm. States are
+ * equivalent when they accept the same action and go to the equivalent
+ * states by every input, the dead state ("state_count") takes part as
+ * well so the states that never accept are removed. */
+template <typename T>
+void minimize_states(DfaTables<T>& tables)
+{
+	unsigned int state_count = (unsigned int)tables.states.size();
+	unsigned int input_count = tables.input_count;
+	unsigned int count = state_count + 1;
+	std::vector<unsigned int>& transits = tables.transits;
+	// A minimum state is left at once, its transits are never used.
+	for (unsigned int i = 0; i < state_count; i++)
+	{
+		if (tables.states[i].flags & DFA_STATE_MINIMUM)
 		{
-			if (transit[idx].state == dfa.accepting_states[j])
+			std::fill(transits.begin() + i * input_count,
+					transits.begin() + (i + 1) * input_count, state_count);
+		}
+	}
+
+	// Sources of every (input, target) pair.
+	std::vector<unsigned int> pred_begin(input_count * count + 1, 0);
+	std::vector<unsigned int> preds(input_count * count);
+	for (unsigned int i = 0; i < count; i++)
+	{
+		for (unsigned int j = 0; j < input_count; j++)
+		{
+			unsigned int to = i < state_count ? transits[i * input_count + j] : state_count;
+			pred_begin[j * count + to + 1]++;
+		}
+	}
+	for (unsigned int i = 0; i < input_count * count; i++)
+		pred_begin[i + 1] += pred_begin[i];
+	{
+		std::vector<unsigned int> fill(pred_begin.begin(), pred_begin.end() - 1);
+		for (unsigned int i = 0; i < count; i++)
+		{
+			for (unsigned int j = 0; j < input_count; j++)
 			{
-				transit[idx].final_state = true;
-				transit[idx].action = dfa.transits[i].action;
-				break;
+				unsigned int to = i < state_count ? transits[i * input_count + j] : state_count;
+				preds[fill[j * count + to]++] = i;
 			}
 		}
 	}
 
-	ActionInfo* action_info = (ActionInfo*)((char*)dfa_data + dfa_data->action_info_offset);
+	// The first blocks are the states of every accepted action.
+	StatePartition part;
+	part.location.resize(count);
+	part.block.resize(count);
+	std::map<unsigned int, unsigned int> initial;
+	for (unsigned int i = 0; i < count; i++)
+	{
+		unsigned int key = 0;
+		if (i < state_count && (tables.states[i].flags & DFA_STATE_FINAL))
+			key = tables.states[i].action + 1U;
+		std::map<unsigned int, unsigned int>::iterator it = initial.find(key);
+		if (it == initial.end())
+		{
+			it = initial.insert(std::make_pair(key, (unsigned int)part.first.size())).first;
+			part.first.push_back(0);
+			part.end.push_back(0);
+		}
+		part.block[i] = it->second;
+		part.end[it->second]++;
+	}
+	unsigned int offset = 0;
+	for (unsigned int b = 0; b < part.first.size(); b++)
+	{
+		part.first[b] = offset;
+		offset += part.end[b];
+		part.end[b] = part.first[b];
+	}
+	part.elements.resize(count);
+	for (unsigned int i = 0; i < count; i++)
+	{
+		unsigned int b = part.block[i];
+		part.location[i] = part.end[b];
+		part.elements[part.end[b]++] = i;
+	}
+	part.mid = part.first;
+
+	// Every block but the biggest one splits the others by every input.
+	typedef std::pair<unsigned int, unsigned int> Splitter;
+	std::vector<Splitter> work;
+	std::vector<char> waiting(part.first.size() * input_count, 0);
+	unsigned int biggest = 0;
+	for (unsigned int b = 1; b < part.first.size(); b++)
+	{
+		if (part.end[b] - part.first[b] > part.end[biggest] - part.first[biggest])
+			biggest = b;
+	}
+	for (unsigned int b = 0; b < part.first.size(); b++)
+	{
+		if (b == biggest)
+			continue;
+		for (unsigned int j = 0; j < input_count; j++)
+		{
+			work.push_back(Splitter(b, j));
+			waiting[b * input_count + j] = 1;
+		}
+	}
 
-	unsigned int name_offset = dfa_data->action_names_offset;
-	for (unsigned int i = 0; i < defines.size(); i++)
+	std::vector<unsigned int> sources;
+	while (!work.empty())
 	{
-		action_info[i].ignore = defines[i].ignore;
-		action_info[i].minimum = defines[i].minimum;
-		action_info[i].name_offset = name_offset;
+		Splitter splitter = work.back();
+		work.pop_back();
+		waiting[splitter.first * input_count + splitter.second] = 0;
+		sources.clear();
+		for (unsigned int k = part.first[splitter.first]; k < part.end[splitter.first]; k++)
+		{
+			unsigned int index = splitter.second * count + part.elements[k];
+			sources.insert(sources.end(), preds.begin() + pred_begin[index],
+					preds.begin() + pred_begin[index + 1]);
+		}
+		for (unsigned int k = 0; k < sources.size(); k++)
+			part.mark(sources[k]);
+
+		for (unsigned int t = 0; t < part.touched.size(); t++)
+		{
+			unsigned int b = part.touched[t];
+			if (part.mid[b] == part.end[b])
+			{
+				part.mid[b] = part.first[b];
+				continue;
+			}
+			// The smaller part becomes the new block.
+			unsigned int nb = (unsigned int)part.first.size();
+			if (part.mid[b] - part.first[b] <= part.end[b] - part.mid[b])
+			{
+				part.first.push_back(part.first[b]);
+				part.end.push_back(part.mid[b]);
+				part.first[b] = part.mid[b];
+			}
+			else
+			{
+				part.first.push_back(part.mid[b]);
+				part.end.push_back(part.end[b]);
+				part.end[b] = part.mid[b];
+			}
+			part.mid[b] = part.first[b];
+			part.mid.push_back(part.first[nb]);
+			for (unsigned int k = part.first[nb]; k < part.end[nb]; k++)
+				part.block[part.elements[k]] = nb;
 
-		copy_str((T*)((char*)dfa_data + action_info[i].name_offset),
-			defines[i].name.c_str());
+			waiting.resize(part.first.size() * input_count, 0);
+			for (unsigned int j = 0; j < input_count; j++)
+			{
+				if (!waiting[b * input_count + j]
+						&& part.end[b] - part.first[b] < part.end[nb] - part.first[nb])
+				{
+					work.push_back(Splitter(b, j));
+					waiting[b * input_count + j] = 1;
+				}
+				else
+				{
+					work.push_back(Splitter(nb, j));
+					waiting[nb * input_count + j] = 1;
+				}
+			}
+		}
+		part.touched.clear();
+	}
 
-		name_offset += (unsigned int)((defines[i].name.length() + 1) * sizeof(T));
+	// Number the blocks by their first state, the dead block stays last.
+	unsigned int dead_block = part.block[state_count];
+	std::vector<unsigned int> block_id(part.first.size(), 0xffffffff);
+	std::vector<unsigned int> members;
+	for (unsigned int i = 0; i < state_count; i++)
+	{
+		unsigned int b = part.block[i];
+		if (b != dead_block && block_id[b] == 0xffffffff)
+		{
+			block_id[b] = (unsigned int)members.size();
+			members.push_back(i);
+		}
 	}
-	return lexical;
+	unsigned int new_count = (unsigned int)members.size();
+	block_id[dead_block] = new_count;
+	if (new_count == state_count)
+		return;
+
+	std::vector<unsigned int> new_transits(new_count * input_count);
+	std::vector<DfaState> new_states(new_count);
+	for (unsigned int i = 0; i < new_count; i++)
+	{
+		const unsigned int* row = &transits[members[i] * input_count];
+		for (unsigned int j = 0; j < input_count; j++)
+			new_transits[i * input_count + j] = block_id[part.block[row[j]]];
+		new_states[i] = tables.states[members[i]];
+	}
+	transits.swap(new_transits);
+	tables.states.swap(new_states);
 }
 
 template <typename T>
-bool valid_dfa_data(const DfaData* data)
+bool valid_char_map(const DfaData* data)
 {
-	if (!data)
-		return false;
-	if (data->header_size != sizeof(DfaData))
-		return false;
-	if (data->data_size < data->header_size)
-		return false;
-
 	unsigned int char_size = 0;
 	unsigned int char_map_count = 0;
 	init_size<T>(char_size, char_map_count);
-	if (data->char_size != char_size ||
-		data->char_map_count != char_map_count)
-		return false;
+	return data->char_size == char_size
+		&& data->char_map_count == char_map_count
+		&& data->char_index_offset == 0;
+}
 
-	if (data->data_size != data->header_size
-		+ data->char_map_count * data->char_size
-		+ data->transit_map_state_count * data->transit_map_input_count * sizeof(DfaTransit)
-		+ data->action_info_count * sizeof(ActionInfo)
-		+ data->action_names_size)
+template <>
+bool valid_char_map<wchar_t>(const DfaData* data)
+{
+	if (data->char_size != sizeof(unsigned short))
 		return false;
-
+	unsigned int end = data->char_map_offset + data->char_map_count * data->char_size;
+	if (end > data->data_size || data->char_index_offset < data->char_map_offset
+		|| data->char_index_offset + CHAR_TOP_SIZE * sizeof(unsigned short) > end)
+		return false;
+	unsigned int leaf_count = (data->char_index_offset - data->char_map_offset)
+			/ sizeof(unsigned short) / CHAR_LEAF_SIZE;
+	unsigned int mid_count = (end - data->char_index_offset) / sizeof(unsigned short)
+			- CHAR_TOP_SIZE;
+	if (leaf_count == 0 || mid_count % CHAR_MID_SIZE != 0)
+		return false;
+	mid_count /= CHAR_MID_SIZE;
+	// Every id must refer to an existing block.
+	const unsigned short* top =
+			(const unsigned short*)((const char*)data + data->char_index_offset);
+	for (unsigned int i = 0; i < CHAR_TOP_SIZE; i++)
+	{
+		if (top[i] >= mid_count)
+			return false;
+	}
+	const unsigned short* mids = top + CHAR_TOP_SIZE;
+	for (unsigned int i = 0; i < mid_count * CHAR_MID_SIZE; i++)
+	{
+		if (mids[i] >= leaf_count)
+			return false;
+	}
 	return true;
 }
 
+/* Convert the dense legacy transits to the per state tables. The
+ * legacy table keeps the accepted action in the transit, so a state
+ * that is reached by transits with different actions is split. */
+template <typename T>
+void split_states(const DfaTransit* transit, unsigned int state_count,
+		DfaTables<T>& tables) throw(std::runtime_error)
+{
+	typedef std::pair<unsigned int, unsigned int> StateKey;
+	typedef std::map<StateKey, unsigned int> StateMap;
+	// Key is (legacy state, accepted action + 1), 0 means not final.
+	std::vector<StateKey> keys;
+	StateMap state_map;
+	keys.push_back(StateKey(0, 0));
+	state_map[keys[0]] = 0;
+
+	unsigned int input_count = tables.input_count;
+	const unsigned int dead = 0xffffffff;
+	tables.transits.clear();
+	for (unsigned int i = 0; i < keys.size(); i++)
+	{
+		const DfaTransit* row = transit + keys[i].first * input_count;
+		for (unsigned int j = 0; j < input_count; j++)
+		{
+			if (row[j].state >= state_count)
+			{
+				tables.transits.push_back(dead);
+				continue;
+			}
+			StateKey key(row[j].state, row[j].final_state ? row[j].action + 1 : 0);
+			typename StateMap::iterator it = state_map.find(key);
+			if (it == state_map.end())
+			{
+				it = state_map.insert(std::make_pair(key, (unsigned int)keys.size())).first;
+				keys.push_back(key);
+			}
+			tables.transits.push_back(it->second);
+		}
+	}
+
+	unsigned int count = (unsigned int)keys.size();
+	for (unsigned int i = 0; i < tables.transits.size(); i++)
+	{
+		if (tables.transits[i] == dead)
+			tables.transits[i] = count;
+	}
+	tables.states.resize(count);
+	for (unsigned int i = 0; i < count; i++)
+	{
+		DfaState& state = tables.states[i];
+		memset(&state, 0, sizeof(DfaState));
+		if (keys[i].second == 0)
+			continue;
+		Action action = keys[i].second - 1;
+		if (action >= tables.actions.size() || action > 0xffff)
+			throw runtime_error("Invalid data format.");
+		state.action = (unsigned short)action;
+		state.flags = DFA_STATE_FINAL;
+		if (tables.actions[action].minimum)
+			state.flags |= DFA_STATE_MINIMUM;
+	}
+}
+
+class ReadTransits
+{
+public:
+	inline ReadTransits(const DfaData* data, std::vector<unsigned int>& transits)
+	: _data(data), _transits(transits)
+	{
+	}
+	template <typename Table>
+	void operator () (const Table& table)
+	{
+		_transits.resize(_data->state_count * _data->input_count);
+		for (unsigned int i = 0; i < _data->state_count; i++)
+			for (unsigned int j = 0; j < _data->input_count; j++)
+				_transits[i * _data->input_count + j] = table.next(i, j);
+	}
+private:
+	const DfaData* _data;
+	std::vector<unsigned int>& _transits;
+};
+
+/* Get the uncompressed tables from the byte code. */
+template <typename T>
+void load_tables(const DfaData* data, DfaTables<T>& tables)
+{
+	const unsigned short* char_map =
+			(const unsigned short*)((const char*)data + data->char_map_offset);
+	tables.char_map.assign(char_map, char_map + data->char_map_count);
+	tables.char_index = 0;
+	if (data->char_index_offset)
+		tables.char_index = (data->char_index_offset - data->char_map_offset)
+				/ sizeof(unsigned short);
+	tables.input_count = data->input_count;
+	ReadTransits read(data, tables.transits);
+	dispatch_table(data, read);
+	const DfaState* states = (const DfaState*)((const char*)data + data->state_info_offset);
+	tables.states.assign(states, states + data->state_count);
+	const ActionInfo* actions = (const ActionInfo*)((const char*)data + data->action_info_offset);
+	tables.actions.assign(actions, actions + data->action_info_count);
+	tables.names.clear();
+	for (unsigned int i = 0; i < data->action_info_count; i++)
+		tables.names.push_back((const T*)((const char*)data + actions[i].name_offset));
+}
+
+/* Get the uncompressed tables from the legacy byte code. */
+template <typename T>
+void load_legacy_tables(const LegacyDfaData* data, DfaTables<T>& tables)
+		throw(std::runtime_error)
+{
+	const unsigned short* char_map =
+			(const unsigned short*)((const char*)data + data->char_map_offset);
+	tables.input_count = data->transit_map_input_count;
+	pack_char_map(char_map, data->char_map_count, tables);
+	const ActionInfo* actions = (const ActionInfo*)((const char*)data + data->action_info_offset);
+	tables.actions.assign(actions, actions + data->action_info_count);
+	tables.names.clear();
+	for (unsigned int i = 0; i < data->action_info_count; i++)
+		tables.names.push_back((const T*)((const char*)data + actions[i].name_offset));
+	split_states((const DfaTransit*)((const char*)data + data->transit_map_offset),
+			data->transit_map_state_count, tables);
+}
+
+/* Count the transits of row 'a' that differ from row 'b', row 'b' may
+ * be the dead row if 'b' is 'state_count'. */
+inline unsigned int diff_rows(const std::vector<unsigned int>& transits,
+		unsigned int state_count, unsigned int input_count,
+		unsigned int a, unsigned int b)
+{
+	const unsigned int* row = &transits[a * input_count];
+	unsigned int count = 0;
+	for (unsigned int j = 0; j < input_count; j++)
+	{
+		if (row[j] != (b == state_count ? state_count : transits[b * input_count + j]))
+			count++;
+	}
+	return count;
+}
+
+/* Row displacement: put every row into one array at the first place
+ * that none of its transits overlap others. A row may only store the
+ * transits that differ from a template row ("fallback"), the template
+ * row itself is stored without dead transits. Return the size of the
+ * array. */
+inline unsigned int make_comb(const std::vector<unsigned int>& transits,
+		unsigned int state_count, unsigned int input_count,
+		std::vector<unsigned int>& base, std::vector<unsigned int>& next,
+		std::vector<unsigned int>& check, std::vector<unsigned int>& fallback)
+{
+	// Choose the template among the states that the row goes to, they
+	// are often similar, such as the keyword states and the name state.
+	fallback.assign(state_count, state_count);
+	for (unsigned int i = 0; i < state_count; i++)
+	{
+		const unsigned int* row = &transits[i * input_count];
+		unsigned int best = diff_rows(transits, state_count, input_count, i, state_count);
+		for (unsigned int j = 0; j < input_count && best > 1; j++)
+		{
+			unsigned int t = row[j];
+			if (t == state_count || t == i || t == fallback[i])
+				continue;
+			unsigned int d = diff_rows(transits, state_count, input_count, i, t);
+			if (d + 1 < best)
+			{
+				best = d;
+				fallback[i] = t;
+			}
+		}
+	}
+	// Template rows can't have template.
+	for (unsigned int i = 0; i < state_count; i++)
+	{
+		if (fallback[i] != state_count)
+			fallback[fallback[i]] = state_count;
+	}
+	for (unsigned int i = 0; i < state_count; i++)
+	{
+		if (fallback[i] != state_count && fallback[fallback[i]] != state_count)
+			fallback[i] = state_count;
+	}
+
+	std::vector<std::vector<unsigned int> > row_cols(state_count);
+	// Place the dense rows first, they are the hardest to fit.
+	std::vector<std::pair<unsigned int, unsigned int> > rows;
+	for (unsigned int i = 0; i < state_count; i++)
+	{
+		const unsigned int* row = &transits[i * input_count];
+		for (unsigned int j = 0; j < input_count; j++)
+		{
+			unsigned int t = fallback[i] == state_count ?
+					state_count : transits[fallback[i] * input_count + j];
+			if (row[j] != t)
+				row_cols[i].push_back(j);
+		}
+		rows.push_back(std::make_pair(input_count - (unsigned int)row_cols[i].size(), i));
+	}
+	std::sort(rows.begin(), rows.end());
+
+	base.assign(state_count, 0);
+	next.clear();
+	check.clear();
+	unsigned int size = 0;
+	for (unsigned int r = 0; r < rows.size(); r++)
+	{
+		unsigned int state = rows[r].second;
+		const unsigned int* row = &transits[state * input_count];
+		const std::vector<unsigned int>& cols = row_cols[state];
+		unsigned int b = 0;
+		for (;; b++)
+		{
+			bool fit = true;
+			for (unsigned int j = 0; j < cols.size() && b + cols[j] < check.size(); j++)
+			{
+				if (check[b + cols[j]] != state_count)
+				{
+					fit = false;
+					break;
+				}
+			}
+			if (fit)
+				break;
+		}
+		base[state] = b;
+		if (check.size() < b + input_count)
+		{
+			check.resize(b + input_count, state_count);
+			next.resize(b + input_count, state_count);
+		}
+		for (unsigned int j = 0; j < cols.size(); j++)
+		{
+			check[b + cols[j]] = state;
+			next[b + cols[j]] = row[cols[j]];
+		}
+		if (b + input_count > size)
+			size = b + input_count;
+	}
+	return size;
+}
+
+template <typename S>
+inline void write_states(void* dest, const std::vector<unsigned int>& source)
+{
+	S* p = (S*)dest;
+	for (unsigned int i = 0; i < source.size(); i++)
+		p[i] = (S)source[i];
+}
+
+inline void write_states(void* dest, const std::vector<unsigned int>& source,
+		unsigned int state_size)
+{
+	if (state_size == 1)
+		write_states<unsigned char>(dest, source);
+	else if (state_size == 2)
+		write_states<unsigned short>(dest, source);
+	else
+		write_states<unsigned int>(dest, source);
+}
+
+/* Input of the byte 'b' in the flat char map. */
+template <typename T>
+inline unsigned short byte_input(const DfaTables<T>& tables, unsigned int b)
+{
+	return tables.char_map[b];
+}
+
+template <>
+inline unsigned short byte_input<char>(const DfaTables<char>& tables, unsigned int b)
+{
+	return tables.char_map[(int)(char)b + 128];
+}
+
+/* Find the states that go to itself by all bytes except a few, the
+ * NUL always ends the input so it is always an exit. */
+template <typename T>
+void find_loops(const DfaTables<T>& tables, std::vector<DfaState>& states)
+{
+	unsigned int state_count = (unsigned int)states.size();
+	for (unsigned int i = 0; i < state_count; i++)
+	{
+		DfaState& state = states[i];
+		state.flags &= ~DFA_STATE_LOOP;
+		state.exit_count = 0;
+		memset(state.exits, 0, sizeof(state.exits));
+		// The minimum state is left at once.
+		if (state.flags & DFA_STATE_MINIMUM)
+			continue;
+		const unsigned int* row = &tables.transits[i * tables.input_count];
+		unsigned char exits[DFA_STATE_EXITS];
+		unsigned int count = 1;
+		exits[0] = 0;
+		for (unsigned int b = 1; b < 256 && count <= DFA_STATE_EXITS; b++)
+		{
+			if (row[byte_input(tables, b)] == i)
+				continue;
+			if (count < DFA_STATE_EXITS)
+				exits[count] = (unsigned char)b;
+			count++;
+		}
+		if (count > DFA_STATE_EXITS)
+			continue;
+		state.flags |= DFA_STATE_LOOP;
+		state.exit_count = (unsigned char)count;
+		memcpy(state.exits, exits, count);
+	}
+}
+
+/* A wide char is not a byte, never skip. */
+template <>
+void find_loops<wchar_t>(const DfaTables<wchar_t>& /*tables*/,
+		std::vector<DfaState>& states)
+{
+	for (unsigned int i = 0; i < states.size(); i++)
+	{
+		states[i].flags &= ~DFA_STATE_LOOP;
+		states[i].exit_count = 0;
+	}
+}
+
+inline unsigned int align_offset(unsigned int offset)
+{
+	return (offset + 3) & ~3U;
+}
+
+/* Build the byte code from the uncompressed tables, the returned memory
+ * should be released by free(). */
+template <typename T>
+void* store_tables(const DfaTables<T>& tables, unsigned int table_type)
+		throw(std::runtime_error)
+{
+	DfaData header;
+	memset(&header, 0, sizeof(header));
+	header.magic = DFA_MAGIC;
+	header.version = DFA_VERSION;
+	header.header_size = sizeof(DfaData);
+	header.char_size = sizeof(unsigned short);
+	header.char_map_count = (unsigned int)tables.char_map.size();
+	header.state_count = (unsigned int)tables.states.size();
+	header.input_count = tables.input_count;
+	// The dead state also need an id.
+	if (header.state_count < 0xff)
+		header.state_size = 1;
+	else if (header.state_count < 0xffff)
+		header.state_size = 2;
+	else
+		header.state_size = 4;
+	header.table_type = table_type;
+
+	std::vector<unsigned int> base, next, check, fallback;
+	if (table_type == DFA_TABLE_COMB)
+		header.transit_count = make_comb(tables.transits, header.state_count,
+				header.input_count, base, next, check, fallback);
+	else
+		header.transit_count = header.state_count * header.input_count;
+
+	header.char_map_offset = header.header_size;
+	if (tables.char_index)
+		header.char_index_offset = header.char_map_offset
+				+ tables.char_index * sizeof(unsigned short);
+	header.state_info_offset = align_offset(header.char_map_offset
+			+ header.char_size * header.char_map_count);
+	header.transit_offset = header.state_info_offset
+			+ header.state_count * sizeof(DfaState);
+	unsigned int end = align_offset(header.transit_offset
+			+ header.transit_count * header.state_size);
+	if (table_type == DFA_TABLE_COMB)
+	{
+		header.check_offset = end;
+		header.fallback_offset = align_offset(header.check_offset
+				+ header.transit_count * header.state_size);
+		header.base_offset = align_offset(header.fallback_offset
+				+ header.state_count * header.state_size);
+		end = header.base_offset + header.state_count * sizeof(unsigned int);
+	}
+	header.action_info_offset = end;
+	header.action_info_count = (unsigned int)tables.actions.size();
+	header.action_names_offset = header.action_info_offset
+			+ header.action_info_count * sizeof(ActionInfo);
+	header.action_names_size = 0;
+	for (unsigned int i = 0; i < tables.names.size(); i++)
+	{
+		if (tables.names[i].length() > 0xffff)
+			throw runtime_error("Token name is too long.");
+		header.action_names_size += (unsigned int)((tables.names[i].length() + 1) * sizeof(T));
+	}
+	header.data_size = header.action_names_offset + header.action_names_size;
+
+	char* data = (char*)malloc(header.data_size);
+	if (!data)
+		throw runtime_error("Out of memory.");
+	memset(data, 0, header.data_size);
+	memcpy(data, &header, sizeof(DfaData));
+	memcpy(data + header.char_map_offset, &tables.char_map[0],
+			header.char_size * header.char_map_count);
+	std::vector<DfaState> states(tables.states);
+	find_loops(tables, states);
+	if (header.state_count > 0)
+		memcpy(data + header.state_info_offset, &states[0],
+				header.state_count * sizeof(DfaState));
+	if (table_type == DFA_TABLE_COMB)
+	{
+		write_states(data + header.transit_offset, next, header.state_size);
+		write_states(data + header.check_offset, check, header.state_size);
+		write_states(data + header.fallback_offset, fallback, header.state_size);
+		if (header.state_count > 0)
+			memcpy(data + header.base_offset, &base[0],
+					header.state_count * sizeof(unsigned int));
+	}
+	else
+		write_states(data + header.transit_offset, tables.transits, header.state_size);
+
+	ActionInfo* action_info = (ActionInfo*)(data + header.action_info_offset);
+	unsigned int name_offset = header.action_names_offset;
+	for (unsigned int i = 0; i < tables.actions.size(); i++)
+	{
+		action_info[i] = tables.actions[i];
+		action_info[i].name_offset = name_offset;
+		action_info[i].name_length = (unsigned short)tables.names[i].length();
+		copy_str((T*)(data + name_offset), tables.names[i].c_str());
+		name_offset += (unsigned int)((tables.names[i].length() + 1) * sizeof(T));
+	}
+	return data;
+}
+
+/* Parse the lexical definition, return the expression of all words. */
+template <typename T>
+typename Exp<T>::ExpPtr parse_defines(std::basic_istream<T>& in,
+		std::vector<Define<T> >& defines, ExpPool<T>& pool) throw(std::runtime_error)
+{
+	Define<T> define_error;
+	error_define<T>(define_error);
+	defines.push_back(define_error);
+
+	// Used for replace defined macro token
+	typedef std::map<std::basic_string<T>, std::basic_string<T> > Repls;
+	Repls repls;
+
+	basic_string<T> line;
+	int line_count = 0;
+	// Whether is the line is extended line.
+	bool is_continue = false;
+	while (in.good())
+	{
+		getline(in, line, (T)'\n');
+		line_count++;
+		// The line continue to the above line.
+		if (_isspace(line[0]))
+			is_continue = true;
+		else
+			is_continue = false;
+
+		trim(line);
+		if (line.empty())
+			continue;
+		if (line[0] == '#')
+		{
+			if (line.length() > 2 && line[1] == '!')
+			{
+				// Define replace macro line
+				line = line.substr(2);
+				size_t find_pos = line.find(':', 0);
+				if (find_pos != string::npos)
+				{
+					basic_string<T> name = line.substr(0, find_pos);
+					trim(name);
+					if (!is_key_name(name))
+						continue;
+					basic_string<T> value = line.substr(find_pos + 1);
+					trim(value);
+					repls[name] = value;
+				}
+			}
+			continue;
+		}
+
+		// Follow the previous line.
+		if (is_continue)
+		{
+			if (defines.size() > 1)
+			{
+				defines.back().value += line;
+			}
+			else
+			{
+				stringstream sbuf;
+				sbuf << "Syntax error: line " << line_count
+						<< ": does not yet have any lines can be extended.";
+				throw runtime_error(sbuf.str().c_str());
+			}
+			continue;
+		}
+
+		// Start a new define line.
+		size_t find_pos = line.find(':', 0);
+		if (find_pos == string::npos)
+		{
+			stringstream sbuf;
+			sbuf << "Syntax error: line " << line_count
+					<< ": must in [NAME]<:><VALUE> format";
+			throw runtime_error(sbuf.str().c_str());
+		}
+
+		basic_string<T> name = line.substr(0, find_pos);
+		bool minimum = false;
+		bool ignore = false;
+		if (!format_key(name, minimum, ignore))
+		{
+			stringstream sbuf;
+			sbuf << "Syntax error: line " << line_count
+					<< ": invalid token name.";
+			throw runtime_error(sbuf.str().c_str());
+		}
+
+		basic_string<T> value = line.substr(find_pos + 1);
+		trim(value);
+		if (value.empty() && !string_compare(name, "error"))
+		{
+			stringstream sbuf;
+			sbuf << "Syntax error: line " << line_count
+					<< ": expression can't be empty.";
+			throw runtime_error(sbuf.str().c_str());
+		}
+
+		if (!string_compare(name, "error"))
+		{
+			Define<T> define =
+			{ name, value, minimum, ignore, line_count};
+			defines.push_back(define);
+		}
+		else
+			defines[0].ignore = ignore;
+	}
+
+
+	//LexRepl<T> repl(defines);
+	// Create expression tree
+	typename Exp<T>::ExpPtr exp = 0;
+	for (size_t i = 1; i < defines.size(); i++)
+	{
+		typename Exp<T>::ExpPtr tmp_exp;
+		try
+		{
+			// asm("INT $3");
+			// Replace {name} with a real regex.
+			std::set<basic_string<T> > repl_keys;
+			defines[i].value = replace_macro<T>(defines[i].value, repls, repl_keys);
+
+			tmp_exp = exp_parse(pool, defines[i].value.c_str());
+		}
+		catch (const std::exception& err)
+		{
+			stringstream sbuf;
+			sbuf << "Syntax error: line " << defines[i].line << ": " << err.what();
+			throw runtime_error(sbuf.str().c_str());
+		}
+		tmp_exp->action = (Action)i;
+		if (exp)
+			exp = exp_join<T>(pool, exp, tmp_exp, RE_JOIN_OR);
+		else
+			exp = tmp_exp;
+	}
+
+	if (!exp)
+		throw runtime_error("No define any words.");
+	return exp;
+}
+
+/* Fill the inputs, the char map and the actions of the tables. */
+template <typename T>
+void init_tables(const typename Dfa<T>::RangeVector& range_map,
+		const std::vector<Define<T> >& defines, DfaTables<T>& tables)
+{
+	tables.input_count = (unsigned int)range_map.size() + 1;
+	std::vector<unsigned short> char_map;
+	init_char_map<T>(char_map, range_map);
+	pack_char_map(&char_map[0], (unsigned int)char_map.size(), tables);
+
+	for (unsigned int i = 0; i < defines.size(); i++)
+	{
+		ActionInfo info;
+		info.ignore = defines[i].ignore;
+		info.minimum = defines[i].minimum;
+		info.name_length = 0;
+		info.name_offset = 0;
+		tables.actions.push_back(info);
+		tables.names.push_back(defines[i].name);
+	}
+}
+
+/* Build the byte code from the expression, the returned memory should
+ * be released by free(). */
+template <typename T>
+void* build_dfa_data(typename Exp<T>::ExpPtr exp, const std::vector<Define<T> >& defines)
+		throw(std::runtime_error)
+{
+	// Create DFA
+	Dfa<T> dfa;
+	make_dfa(exp, dfa);
+
+	DfaTables<T> tables;
+	init_tables(dfa.range_map, defines, tables);
+
+	// Make the transit map as the legacy format, then split the
+	// states by the accepted action.
+	std::vector<DfaTransit> transit(dfa.total_states * tables.input_count);
+	for (unsigned int i = 0; i < transit.size(); i++)
+	{
+		transit[i].final_state = false;
+		transit[i].state = dfa.total_states;
+		transit[i].action = 0;
+	}
+	for (unsigned int i = 0; i < dfa.transits.size(); i++)
+	{
+		unsigned int idx = dfa.transits[i].from * tables.input_count
+				+ dfa.transits[i].input;
+
+		transit[idx].state = dfa.transits[i].to;
+		transit[idx].final_state = false;
+		transit[idx].action = 0;
+		for (unsigned int j = 0; j < dfa.accepting_states.size(); j++)
+		{
+			if (transit[idx].state == dfa.accepting_states[j])
+			{
+				transit[idx].final_state = true;
+				transit[idx].action = dfa.transits[i].action;
+				break;
+			}
+		}
+	}
+	split_states(&transit[0], dfa.total_states, tables);
+	minimize_states(tables);
+	return store_tables(tables, DFA_TABLE_DENSE);
+}
+
+template <typename T>
+typename CompiledLexer<T>::CompiledLexerPtr CompiledLexer<T>::create_by_stream(std::basic_istream<T>& in)
+		throw(std::runtime_error)
+{
+	std::vector<Define<T> > defines;
+	ExpPool<T> pool;
+	typename Exp<T>::ExpPtr exp = parse_defines(in, defines, pool);
+	CompiledLexerPtr lexical(new CompiledLexer());
+	lexical->_data = build_dfa_data<T>(exp, defines);
+	lexical->_allocated = true;
+	return lexical;
+}
+
+template <typename T>
+typename CompiledLexer<T>::CompiledLexerPtr CompiledLexer<T>::create_lazy(
+		const std::basic_string<T>& lexical, unsigned long cache_size) throw(std::runtime_error)
+{
+	basic_istringstream<T> in(lexical);
+	return create_lazy_by_stream(in, cache_size);
+}
+
+template <typename T>
+typename CompiledLexer<T>::CompiledLexerPtr CompiledLexer<T>::create_lazy_by_stream(
+		std::basic_istream<T>& in, unsigned long cache_size) throw(std::runtime_error)
+{
+	std::vector<Define<T> > defines;
+	ExpPool<T> pool;
+	typename Exp<T>::ExpPtr exp = parse_defines(in, defines, pool);
+	if (defines.size() > 0x10000)
+		throw runtime_error("Too many actions.");
+	std::shared_ptr<LazyDfa<T> > lazy(new LazyDfa<T>());
+	make_nfa(exp, lazy->nfa);
+	lazy->input_count = (unsigned int)lazy->nfa.range_map.size() + 1;
+	lazy->cache_size = cache_size;
+	for (unsigned int i = 0; i < defines.size(); i++)
+		lazy->minimum.push_back(defines[i].minimum);
+
+	// The byte code has the char map and the actions, its only state
+	// matches nothing, the scanners build the real states.
+	DfaTables<T> tables;
+	init_tables(lazy->nfa.range_map, defines, tables);
+	DfaState state;
+	memset(&state, 0, sizeof(DfaState));
+	tables.states.push_back(state);
+	tables.transits.assign(tables.input_count, 1);
+
+	CompiledLexerPtr lexical(new CompiledLexer());
+	lexical->_data = store_tables(tables, DFA_TABLE_DENSE);
+	lexical->_allocated = true;
+	lexical->_lazy = lazy;
+	return lexical;
+}
+
+template <typename T> inline
+typename Exp<T>::ExpPtr utf8_exp(ExpPool<T>& pool, Exp<wchar_t>::ExpPtr exp)
+{
+	return exp_utf8<T>(pool, exp);
+}
+template <> inline
+Exp<wchar_t>::ExpPtr utf8_exp<wchar_t>(ExpPool<wchar_t>& /*pool*/, Exp<wchar_t>::ExpPtr /*exp*/)
+{
+	throw runtime_error("UTF-8 lexical must use char or unsigned char.");
+}
+
+template <typename T> inline
+const std::basic_string<T> utf8_name(const std::wstring& name);
+template <> inline
+const std::string utf8_name<char>(const std::wstring& name)
+{
+	return wstring_to_utf8(name);
+}
+template <> inline
+const std::basic_string<unsigned char> utf8_name<unsigned char>(const std::wstring& name)
+{
+	std::string str = wstring_to_utf8(name);
+	return std::basic_string<unsigned char>(str.begin(), str.end());
+}
+template <> inline
+const std::wstring utf8_name<wchar_t>(const std::wstring& name)
+{
+	return name;
+}
+
+template <typename T>
+typename CompiledLexer<T>::CompiledLexerPtr CompiledLexer<T>::create_utf8(const std::wstring& lexical)
+		throw(std::runtime_error)
+{
+	std::string cache = cache_file<T>("utf8-", lexical);
+	if (!cache.empty())
+	{
+		CompiledLexerPtr lexer = create_by_cache(cache);
+		if (lexer)
+			return lexer;
+	}
+	std::wistringstream in(lexical);
+	CompiledLexerPtr lexer = create_utf8_by_stream(in);
+	if (!cache.empty())
+		store_cache(cache, lexer->_data);
+	return lexer;
+}
+
+template <typename T>
+typename CompiledLexer<T>::CompiledLexerPtr CompiledLexer<T>::create_utf8_by_file(const std::string& filename)
+		throw(std::runtime_error)
+{
+	std::wstring str;
+	load_text_file_to_wstring(filename, str);
+	return create_utf8(str);
+}
+
+template <typename T>
+typename CompiledLexer<T>::CompiledLexerPtr CompiledLexer<T>::create_utf8_by_stream(std::wistream& in)
+		throw(std::runtime_error)
+{
+	std::vector<Define<wchar_t> > wide_defines;
+	ExpPool<T> pool;
+	typename Exp<T>::ExpPtr exp;
+	{
+		ExpPool<wchar_t> wide_pool;
+		Exp<wchar_t>::ExpPtr wide_exp = parse_defines(in, wide_defines, wide_pool);
+		exp = utf8_exp<T>(pool, wide_exp);
+	}
+
+	std::vector<Define<T> > defines;
+	for (size_t i = 0; i < wide_defines.size(); i++)
+	{
+		Define<T> define =
+		{ utf8_name<T>(wide_defines[i].name), basic_string<T>(),
+			wide_defines[i].minimum, wide_defines[i].ignore, wide_defines[i].line };
+		defines.push_back(define);
+	}
+	CompiledLexerPtr lexical(new CompiledLexer());
+	lexical->_data = build_dfa_data<T>(exp, defines);
+	lexical->_allocated = true;
+	return lexical;
+}
+
+template <typename T>
+bool valid_legacy_dfa_data(const LegacyDfaData* data, unsigned long data_len)
+{
+	if (data_len < sizeof(LegacyDfaData))
+		return false;
+	if (data->header_size != sizeof(LegacyDfaData))
+		return false;
+	if (data->data_size < data->header_size || data_len < data->data_size)
+		return false;
+
+	unsigned int char_size = 0;
+	unsigned int char_map_count = 0;
+	init_size<T>(char_size, char_map_count);
+	if (data->char_size != char_size ||
+		data->char_map_count != char_map_count)
+		return false;
+
+	if (data->data_size != data->header_size
+		+ data->char_map_count * data->char_size
+		+ data->transit_map_state_count * data->transit_map_input_count * sizeof(DfaTransit)
+		+ data->action_info_count * sizeof(ActionInfo)
+		+ data->action_names_size)
+		return false;
+
+	return true;
+}
+
+template <typename T>
+bool valid_dfa_data(const DfaData* data, unsigned long data_len)
+{
+	if (data_len < sizeof(DfaData))
+		return false;
+	if (data->magic != DFA_MAGIC || data->version != DFA_VERSION)
+		return false;
+	if (data->header_size != sizeof(DfaData))
+		return false;
+	if (data->data_size < data->header_size || data_len < data->data_size)
+		return false;
+
+	if (!valid_char_map<T>(data))
+		return false;
+
+	if (data->state_size != 1 && data->state_size != 2 && data->state_size != 4)
+		return false;
+	if (data->state_size < 4 && data->state_count >= (1U << (data->state_size * 8)) - 1)
+		return false;
+	if (data->table_type != DFA_TABLE_DENSE && data->table_type != DFA_TABLE_COMB)
+		return false;
+
+	if (data->char_map_offset + data->char_map_count * data->char_size > data->data_size
+		|| data->state_info_offset + data->state_count * sizeof(DfaState) > data->data_size
+		|| data->transit_offset + data->transit_count * data->state_size > data->data_size
+		|| data->action_info_offset + data->action_info_count * sizeof(ActionInfo) > data->data_size
+		|| data->action_names_offset + data->action_names_size > data->data_size)
+		return false;
+	if (data->table_type == DFA_TABLE_COMB)
+	{
+		if (data->check_offset + data->transit_count * data->state_size > data->data_size
+			|| data->fallback_offset + data->state_count * data->state_size > data->data_size
+			|| data->base_offset + data->state_count * sizeof(unsigned int) > data->data_size)
+			return false;
+	}
+	else if (data->transit_count != data->state_count * data->input_count)
+		return false;
+
+	const DfaState* states = (const DfaState*)((const char*)data + data->state_info_offset);
+	for (unsigned int i = 0; i < data->state_count; i++)
+	{
+		if ((states[i].flags & DFA_STATE_LOOP) && (states[i].exit_count == 0
+			|| states[i].exit_count > DFA_STATE_EXITS || sizeof(T) != 1))
+			return false;
+	}
+	const ActionInfo* actions = (const ActionInfo*)((const char*)data + data->action_info_offset);
+	for (unsigned int i = 0; i < data->action_info_count; i++)
+	{
+		if (actions[i].name_offset < data->action_names_offset
+			|| actions[i].name_offset + (actions[i].name_length + 1) * sizeof(T)
+				> data->action_names_offset + data->action_names_size)
+			return false;
+	}
+
+	return true;
+}
+
+/* Check the byte code, if it is the legacy format then convert it
+ * to the current format and return the new allocated data, otherwise
+ * return 0. */
+template <typename T>
+void* check_dfa_data(const void* data, unsigned long data_len)
+		throw(std::runtime_error)
+{
+	if (data_len >= sizeof(unsigned int)
+		&& *(const unsigned int*)data == sizeof(LegacyDfaData))
+	{
+		if (!valid_legacy_dfa_data<T>((const LegacyDfaData*)data, data_len))
+			throw runtime_error("Invalid data format.");
+		DfaTables<T> tables;
+		load_legacy_tables((const LegacyDfaData*)data, tables);
+		return store_tables(tables, DFA_TABLE_DENSE);
+	}
+	if (!valid_dfa_data<T>((const DfaData*)data, data_len))
+		throw runtime_error("Invalid data format.");
+	return 0;
+}
+
+template <typename T>
+typename CompiledLexer<T>::CompiledLexerPtr CompiledLexer<T>::create_by_bc_file(const std::string& filename)
+		throw(std::runtime_error)
+{
+	ifstream infile(filename.c_str(), ios::in | ios::binary);
+	if (!infile.is_open())
+		throw runtime_error("Can't open file.");
+
+	std::vector<char> data;
+	char buffer[4096];
+	while (infile.good())
+	{
+		infile.read(buffer, sizeof(buffer));
+		data.insert(data.end(), buffer, buffer + infile.gcount());
+	}
+	infile.close();
+	if (data.empty())
+		throw runtime_error("Invalid file format.");
+
+	return create_by_bc(&data[0], (unsigned long)data.size());
+}
+
+
+template <typename T>
+typename CompiledLexer<T>::CompiledLexerPtr CompiledLexer<T>::create_by_bc(const void* data, unsigned long data_len)
+		throw(std::runtime_error)
+{
+	if (!data)
+		throw runtime_error("Invalid data format.");
+
+	CompiledLexerPtr lexical(new CompiledLexer());
+	lexical->_data = check_dfa_data<T>(data, data_len);
+	if (!lexical->_data)
+	{
+		DfaData* dfa_data = (DfaData*)data;
+		lexical->_data = malloc(dfa_data->data_size);
+		if (!lexical->_data)
+			throw runtime_error("Out of memory.");
+		memcpy(lexical->_data, data, dfa_data->data_size);
+	}
+	lexical->_allocated = true;
+	return lexical;
+}
+
+template <typename T>
+typename CompiledLexer<T>::CompiledLexerPtr CompiledLexer<T>::create_by_static_bc(const void* data, unsigned long data_len)
+		throw(std::runtime_error)
+{
+	if (!data)
+		throw runtime_error("Invalid data format.");
+
+	CompiledLexerPtr lexical(new CompiledLexer());
+	// Legacy byte code have to be converted, so it can't be used in place.
+	lexical->_data = check_dfa_data<T>(data, data_len);
+	if (lexical->_data)
+		lexical->_allocated = true;
+	else
+	{
+		lexical->_data = (void*)data;
+		lexical->_allocated = false;
+	}
+	return lexical;
+}
+
+template <typename T>
+typename CompiledLexer<T>::CompiledLexerPtr CompiledLexer<T>::create_by_cache(const std::string& filename)
+{
+	unsigned long size = 0;
+	const void* data = map_file(filename, size);
+	if (!data)
+		return CompiledLexerPtr();
+	CompiledLexerPtr lexical(new CompiledLexer());
+	try
+	{
+		lexical->_data = check_dfa_data<T>(data, size);
+	}
+	catch (const std::exception&)
+	{
+		// Broken or of another version, it will be compiled again.
+		unmap_file(data, size);
+		return CompiledLexerPtr();
+	}
+	if (lexical->_data)
+	{
+		unmap_file(data, size);
+		lexical->_allocated = true;
+	}
+	else
+	{
+		lexical->_data = (void*)data;
+		lexical->_mapped = size;
+	}
+	return lexical;
+}
+
+template <typename T>
+typename CompiledLexer<T>::CompiledLexerPtr CompiledLexer<T>::compress() const
+		throw(std::runtime_error)
+{
+	if (!_data)
+		throw std::runtime_error("Not initialized.");
+	if (_lazy)
+		throw std::runtime_error("A lazy lexical has no tables.");
+	DfaData* dfa_data = (DfaData*)_data;
+	DfaTables<T> tables;
+	load_tables(dfa_data, tables);
+	CompiledLexerPtr lexical(new CompiledLexer());
+	lexical->_data = store_tables(tables, DFA_TABLE_COMB);
+	lexical->_allocated = true;
+	return lexical;
+}
+
+template <typename T>
+void CompiledLexer<T>::save_bc(const std::string& filename) const throw(std::runtime_error)
+{
+	if (!_data)
+		throw std::runtime_error("Not initialized.");
+	if (_lazy)
+		throw std::runtime_error("A lazy lexical has no tables.");
+	ofstream outfile(filename.c_str(), ios::out | ios::binary);
+	if (!outfile.good())
+		throw runtime_error("Can't open file.");
+
+	DfaData* dfa_data = (DfaData*)_data;
+	outfile.write((char*)_data, dfa_data->data_size);
+	if (!outfile.good())
+	{
+		outfile.close();
+		throw runtime_error("Write file error.");
+	}
+	outfile.close();
+}
+
+/* Type name of the character in the generated scanner. */
+template <typename T>
+inline const char* cpp_char_type();
+template <>
+inline const char* cpp_char_type<char>()
+{
+	return "char";
+}
+template <>
+inline const char* cpp_char_type<unsigned char>()
+{
+	return "unsigned char";
+}
+
+/* Goto a state of the generated scanner, the dead state stops scanning. */
+inline void write_cpp_goto(std::ostream& out, unsigned int state, unsigned int dead)
+{
+	if (state == dead)
+		out << "goto dead;\n";
+	else
+		out << "goto s" << state << ";\n";
+}
+
+/* Write a direct coded scanner, every state is a label and every transit
+ * is a "goto", so the compiler can see the whole DFA. */
+template <typename T>
+void write_cpp(std::ostream& out, const DfaTables<T>& tables, const std::string& name)
+{
+	unsigned int state_count = (unsigned int)tables.states.size();
+	const char* type = cpp_char_type<T>();
+	out << "/* Generated by lexgen, don't edit it.\n"
+		" *\n"
+		" * unsigned int " << name << "_scan(const " << type << "* p, const "
+		<< type << "* end,\n"
+		" *		bool best_match, unsigned int* length);\n"
+		" *\n"
+		" * Scan a token at 'p', the text ends at 'end' or NUL. Return the action\n"
+		" * id and set the length of the token, 0 means the end of text. It finds\n"
+		" * the same tokens as Lexical::next() but doesn't count the lines. */\n\n";
+
+	out << "extern const unsigned int " << name << "_action_count = "
+		<< tables.actions.size() << ";\n\n";
+	out << "extern const char* const " << name << "_names[] =\n{\n";
+	for (unsigned int i = 0; i < tables.names.size(); i++)
+	{
+		out << "\t\"";
+		for (unsigned int j = 0; j < tables.names[i].length(); j++)
+		{
+			char ch = (char)tables.names[i][j];
+			if (ch == '"' || ch == '\\')
+				out << '\\';
+			out << ch;
+		}
+		out << "\",\n";
+	}
+	out << "};\n\n";
+	out << "extern const bool " << name << "_ignore[] =\n{\n";
+	for (unsigned int i = 0; i < tables.actions.size(); i++)
+		out << "\t" << (tables.actions[i].ignore ? "true" : "false") << ",\n";
+	out << "};\n\n";
+
+	out << "unsigned int " << name << "_scan(const " << type << "* p, const "
+		<< type << "* end,\n"
+		"		bool best_match, unsigned int* length)\n"
+		"{\n"
+		"	const " << type << "* start = p;\n"
+		"	const " << type << "* accept = p;\n"
+		"	unsigned int action = 0;\n"
+		"	unsigned char ch;\n";
+	// Label of the start state is used only if some transit goes back.
+	bool restart = std::find(tables.transits.begin(), tables.transits.end(), 0U)
+			!= tables.transits.end();
+	for (unsigned int i = 0; i < state_count; i++)
+	{
+		const DfaState& state = tables.states[i];
+		const unsigned int* row = &tables.transits[i * tables.input_count];
+		if (i > 0 || restart)
+			out << "s" << i << ":\n";
+		if (state.flags & DFA_STATE_FINAL)
+		{
+			out << "\taction = " << state.action << ";\n"
+				"\taccept = p;\n";
+			if (state.flags & DFA_STATE_MINIMUM)
+			{
+				out << "\tgoto done;\n";
+				continue;
+			}
+		}
+		out << "\tif (p == end || *p == 0)\n"
+			"\t\tgoto eof;\n"
+			"\tch = (unsigned char)*p++;\n";
+
+		// Group the bytes by the target, the biggest group is the default.
+		std::map<unsigned int, std::vector<unsigned int> > groups;
+		for (unsigned int b = 1; b < 256; b++)
+			groups[row[byte_input(tables, b)]].push_back(b);
+		std::map<unsigned int, std::vector<unsigned int> >::const_iterator it;
+		unsigned int others = state_count;
+		size_t most = 0;
+		for (it = groups.begin(); it != groups.end(); ++it)
+		{
+			if (it->second.size() > most)
+			{
+				most = it->second.size();
+				others = it->first;
+			}
+		}
+		if (groups.size() == 1)
+		{
+			out << "\t";
+			write_cpp_goto(out, others, state_count);
+			continue;
+		}
+		out << "\tswitch (ch)\n"
+			"\t{\n";
+		for (it = groups.begin(); it != groups.end(); ++it)
+		{
+			if (it->first == others)
+				continue;
+			for (unsigned int j = 0; j < it->second.size(); j++)
+			{
+				out << ((j % 8) ? " " : "\t") << "case " << it->second[j] << ":";
+				if (j % 8 == 7 || j + 1 == it->second.size())
+					out << "\n";
+			}
+			out << "\t\t";
+			write_cpp_goto(out, it->first, state_count);
+		}
+		out << "\tdefault:\n"
+			"\t\t";
+		write_cpp_goto(out, others, state_count);
+		out << "\t}\n";
+	}
+	out << "dead:\n"
+		"	if (action == 0)\n"
+		"	{\n"
+		"		*length = best_match ? 1 : (unsigned int)(p - start);\n"
+		"		return 0;\n"
+		"	}\n"
+		"	goto done;\n"
+		"eof:\n"
+		"	if (action == 0)\n"
+		"	{\n"
+		"		*length = (best_match && p - start > 1) ? 1 : (unsigned int)(p - start);\n"
+		"		return 0;\n"
+		"	}\n"
+		"done:\n"
+		"	*length = (unsigned int)(accept - start);\n"
+		"	return action;\n"
+		"}\n";
+}
+
+template <>
+void write_cpp<wchar_t>(std::ostream& /*out*/, const DfaTables<wchar_t>& /*tables*/,
+		const std::string& /*name*/)
+{
+	throw runtime_error("Only the byte lexical can be saved as C++.");
+}
+
+template <typename T>
+void CompiledLexer<T>::save_cpp(const std::string& filename, const std::string& name) const
+		throw(std::runtime_error)
+{
+	if (!_data)
+		throw std::runtime_error("Not initialized.");
+	if (_lazy)
+		throw std::runtime_error("A lazy lexical has no tables.");
+	if (!is_key_name(name))
+		throw std::runtime_error("Invalid scanner name.");
+	DfaTables<T> tables;
+	load_tables((const DfaData*)_data, tables);
+	ostringstream code;
+	write_cpp(code, tables, name);
+
+	ofstream outfile(filename.c_str(), ios::out | ios::binary);
+	if (!outfile.good())
+		throw runtime_error("Can't open file.");
+	outfile << code.str();
+	if (!outfile.good())
+	{
+		outfile.close();
+		throw runtime_error("Write file error.");
+	}
+	outfile.close();
+}
+
+
+template <typename T>
+CompiledLexer<T>::CompiledLexer()
+: _data(0), _allocated(false), _mapped(0)
+{
+}
+
+template <typename T>
+CompiledLexer<T>::~CompiledLexer()
+{
+	if (_data && _allocated)
+		free(_data);
+	else if (_data && _mapped)
+		unmap_file(_data, _mapped);
+}
+
+template <typename T>
+Scanner<T>::Scanner(const CompiledLexerPtr& lexer) throw(std::runtime_error)
+: best_match(false), lazy_lines(false), _data(0), _indexed(0)
+{
+	if (!lexer)
+		throw std::runtime_error("Invalid parameters.");
+	set_lexer(lexer);
+	reset();
+}
+
+template <typename T>
+void Scanner<T>::set_lexer(const CompiledLexerPtr& lexer)
+{
+	_lexer = lexer;
+	_data = lexer->_data;
+	if (lexer->_lazy)
+		_cache.reset(new LazyCache<T>(*lexer->_lazy));
+	else
+		_cache.reset();
+	_search.reset();
+}
+
+template <typename T>
+Lexical<T>::Lexical(const CompiledLexerPtr& lexer)
+: Scanner<T>(lexer)
+{
+}
+
+template <typename T>
+typename Lexical<T>::LexicalPtr Lexical<T>::create(const std::basic_string<T>& lexical)
+		throw(std::runtime_error)
+{
+	return LexicalPtr(new Lexical(CompiledLexer<T>::create(lexical)));
+}
+
+template <typename T>
+typename Lexical<T>::LexicalPtr Lexical<T>::create_by_file(const std::string& filename)
+		throw(std::runtime_error)
+{
+	return LexicalPtr(new Lexical(CompiledLexer<T>::create_by_file(filename)));
+}
+
+template <typename T>
+typename Lexical<T>::LexicalPtr Lexical<T>::create_by_bc(const void* data, unsigned long data_len)
+		throw(std::runtime_error)
+{
+	return LexicalPtr(new Lexical(CompiledLexer<T>::create_by_bc(data, data_len)));
+}
+
+template <typename T>
+typename Lexical<T>::LexicalPtr Lexical<T>::create_by_static_bc(const void* data,
+		unsigned long data_len) throw(std::runtime_error)
+{
+	return LexicalPtr(new Lexical(CompiledLexer<T>::create_by_static_bc(data, data_len)));
+}
+
+template <typename T>
+typename Lexical<T>::LexicalPtr Lexical<T>::create_by_bc_file(const std::string& filename)
+		throw(std::runtime_error)
+{
+	return LexicalPtr(new Lexical(CompiledLexer<T>::create_by_bc_file(filename)));
+}
+
+template <typename T>
+typename Lexical<T>::LexicalPtr Lexical<T>::create_by_stream(std::basic_istream<T>& in)
+		throw(std::runtime_error)
+{
+	return LexicalPtr(new Lexical(CompiledLexer<T>::create_by_stream(in)));
+}
+
+template <typename T>
+typename Lexical<T>::LexicalPtr Lexical<T>::create_utf8(const std::wstring& lexical)
+		throw(std::runtime_error)
+{
+	return LexicalPtr(new Lexical(CompiledLexer<T>::create_utf8(lexical)));
+}
+
+template <typename T>
+typename Lexical<T>::LexicalPtr Lexical<T>::create_utf8_by_file(const std::string& filename)
+		throw(std::runtime_error)
+{
+	return LexicalPtr(new Lexical(CompiledLexer<T>::create_utf8_by_file(filename)));
+}
+
+template <typename T>
+typename Lexical<T>::LexicalPtr Lexical<T>::create_utf8_by_stream(std::wistream& in)
+		throw(std::runtime_error)
+{
+	return LexicalPtr(new Lexical(CompiledLexer<T>::create_utf8_by_stream(in)));
+}
+
+template <typename T>
+typename Lexical<T>::LexicalPtr Lexical<T>::create_lazy(const std::basic_string<T>& lexical,
+		unsigned long cache_size) throw(std::runtime_error)
+{
+	return LexicalPtr(new Lexical(CompiledLexer<T>::create_lazy(lexical, cache_size)));
+}
+
+template <typename T>
+typename Lexical<T>::LexicalPtr Lexical<T>::create_lazy_by_stream(std::basic_istream<T>& in,
+		unsigned long cache_size) throw(std::runtime_error)
+{
+	return LexicalPtr(new Lexical(CompiledLexer<T>::create_lazy_by_stream(in, cache_size)));
+}
+
+template <typename T>
+void Lexical<T>::save_bc(const std::string& filename) throw(std::runtime_error)
+{
+	this->_lexer->save_bc(filename);
+}
+
+template <typename T>
+void Lexical<T>::save_cpp(const std::string& filename, const std::string& name)
+		throw(std::runtime_error)
+{
+	this->_lexer->save_cpp(filename, name);
+}
+
+template <typename T>
+void Lexical<T>::compress() throw(std::runtime_error)
+{
+	DfaData* dfa_data = (DfaData*)this->_data;
+	if (dfa_data->table_type == DFA_TABLE_COMB)
+		return;
+	this->set_lexer(this->_lexer->compress());
+}
+
+template <typename T>
+void Scanner<T>::parse(std::basic_istream<T>& input_stream) throw(std::runtime_error)
+{
+	_env.in = &input_stream;
+	if (!_env.in)
+		throw std::runtime_error("Invalid parameters.");
+	_env.buffer = 0;
+	_env.buffer_end = 0;
+	std::streampos begin = _env.in->tellg();
+	if (begin == std::streampos(-1))
+	{
+		// Pipes, sockets and console can not tell the position,
+		// so count the position from where we start.
+		_env.in->clear();
+		_env.begin = 0;
+	}
+	else
+		_env.begin = (size_t)begin;
+	_env.window.clear();
+	_env.window_pos = _env.begin;
+	reset();
+}
+
+template <typename T>
+void Scanner<T>::parse(const T* input_string) throw(std::runtime_error)
+{
+	if (!input_string)
+		throw std::runtime_error("Invalid parameters.");
+	parse(input_string, std::char_traits<T>::length(input_string));
+}
+
+template <typename T>
+void Scanner<T>::parse(const T* input_buffer, size_t buffer_len) throw(std::runtime_error)
+{
+	if (!input_buffer)
+		throw std::runtime_error("Invalid parameters.");
+	_env.in = 0;
+	_env.buffer = input_buffer;
+	_env.buffer_end = input_buffer + buffer_len;
+	_env.begin = 0;
+	_lines.clear();
+	_indexed = 0;
+	reset();
+}
+
+
+template <typename T>
+void Scanner<T>::reset() throw(std::runtime_error)
+{
+	// If all of the characters since the beginning are still in the
+	// look ahead window then needn't to touch the stream.
+	if (_env.in && _env.window_pos != _env.begin)
+	{
+		_env.in->clear();
+		_env.in->seekg(_env.begin, ios::beg);
+		if (_env.in->fail())
+		{
+			_env.in->clear();
+			throw std::runtime_error("Stream is not seekable.");
+		}
+		_env.window.clear();
+		_env.window_pos = _env.begin;
+	}
+	_env.line = 1;
+	_env.line_pos = 1;
+	_env.cur = _env.begin;
+	reset_state();
+}
+
+
+template <typename T>
+inline void next_char(LexicalEnv<T>& env, T ch)
+{
+	env.cur++;
+	if (ch == '\n')
+	{
+		env.line++;
+		env.line_pos = 1;
+	}
+	else
+		env.line_pos++;
+}
+
+inline unsigned int bit_scan(unsigned int mask)
+{
+#if defined(__GNUC__)
+	return (unsigned int)__builtin_ctz(mask);
+#else
+	unsigned int i = 0;
+	while (!(mask & 1))
+	{
+		mask >>= 1;
+		i++;
+	}
+	return i;
+#endif
+}
+
+inline unsigned int bit_scan_reverse(unsigned int mask)
+{
+#if defined(__GNUC__)
+	return 31 - (unsigned int)__builtin_clz(mask);
+#else
+	unsigned int i = 31;
+	while (!(mask & 0x80000000U))
+	{
+		mask <<= 1;
+		i--;
+	}
+	return i;
+#endif
+}
+
+inline unsigned int bit_count(unsigned int mask)
+{
+#if defined(__GNUC__)
+	return (unsigned int)__builtin_popcount(mask);
+#else
+	unsigned int count = 0;
+	for (; mask; mask &= mask - 1)
+		count++;
+	return count;
+#endif
+}
+
+/* The bytes in the 'mask' are the new lines, 'p' is the first byte of the
+ * mask, 'last' is set to the last new line. */
+inline void count_lines(unsigned int mask, const unsigned char* p,
+		unsigned int& lines, const unsigned char*& last)
+{
+	if (mask)
+	{
+		lines += bit_count(mask);
+		last = p + bit_scan_reverse(mask);
+	}
+}
+
+/* Find the first exit of a loop state in [p, end), return 'end' if
+ * not found, the new lines before it are counted if 'Lines' is set. */
+template <bool Lines>
+inline const unsigned char* find_exit(const unsigned char* p, const unsigned char* end,
+		const DfaState& state, unsigned int& lines, const unsigned char*& last)
+{
+	unsigned int count = state.exit_count;
+#ifdef __AVX2__
+	{
+		__m256i exits[DFA_STATE_EXITS];
+		for (unsigned int i = 0; i < count; i++)
+			exits[i] = _mm256_set1_epi8((char)state.exits[i]);
+		const __m256i nl = _mm256_set1_epi8('\n');
+		for (; end - p >= 32; p += 32)
+		{
+			__m256i v = _mm256_loadu_si256((const __m256i*)p);
+			__m256i hit = _mm256_cmpeq_epi8(v, exits[0]);
+			for (unsigned int i = 1; i < count; i++)
+				hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, exits[i]));
+			unsigned int mask = (unsigned int)_mm256_movemask_epi8(hit);
+			unsigned int nl_mask = Lines ?
+					(unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, nl)) : 0;
+			if (mask)
+			{
+				unsigned int n = bit_scan(mask);
+				count_lines(nl_mask & ((1U << n) - 1), p, lines, last);
+				return p + n;
+			}
+			count_lines(nl_mask, p, lines, last);
+		}
+	}
+#endif
+#ifdef LEXICAL_SSE2
+	{
+		__m128i exits[DFA_STATE_EXITS];
+		for (unsigned int i = 0; i < count; i++)
+			exits[i] = _mm_set1_epi8((char)state.exits[i]);
+		const __m128i nl = _mm_set1_epi8('\n');
+		for (; end - p >= 16; p += 16)
+		{
+			__m128i v = _mm_loadu_si128((const __m128i*)p);
+			__m128i hit = _mm_cmpeq_epi8(v, exits[0]);
+			for (unsigned int i = 1; i < count; i++)
+				hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, exits[i]));
+			unsigned int mask = (unsigned int)_mm_movemask_epi8(hit);
+			unsigned int nl_mask = Lines ?
+					(unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(v, nl)) : 0;
+			if (mask)
+			{
+				unsigned int n = bit_scan(mask);
+				count_lines(nl_mask & ((1U << n) - 1), p, lines, last);
+				return p + n;
+			}
+			count_lines(nl_mask, p, lines, last);
+		}
+	}
+#endif
+	for (; p < end; p++)
+	{
+		for (unsigned int i = 0; i < count; i++)
+		{
+			if (*p == state.exits[i])
+				return p;
+		}
+		if (Lines && *p == '\n')
+		{
+			lines++;
+			last = p;
+		}
+	}
+	return p;
+}
+
+/* Skip the characters of [p, end) that keep the loop state, return the
+ * count of them. The line is not counted if 'track_lines' is not set. */
+template <typename T>
+inline size_t skip_loop(LexicalEnv<T>& env, const T* p, const T* end,
+		const DfaState& state, bool track_lines)
+{
+	const unsigned char* begin = (const unsigned char*)p;
+	unsigned int lines = 0;
+	const unsigned char* last = 0;
+	const unsigned char* stop;
+	if (track_lines)
+		stop = find_exit<true>(begin, (const unsigned char*)end, state, lines, last);
+	else
+		stop = find_exit<false>(begin, (const unsigned char*)end, state, lines, last);
+	size_t count = stop - begin;
+	env.cur += count;
+	if (!track_lines)
+		return count;
+	if (lines)
+	{
+		env.line += lines;
+		env.line_pos = (unsigned int)(stop - last);
+	}
+	else
+		env.line_pos += (unsigned int)count;
+	return count;
+}
+
+/* Loop states are never marked for the wide char. */
+template <>
+inline size_t skip_loop<wchar_t>(LexicalEnv<wchar_t>& /*env*/,
+		const wchar_t* /*p*/, const wchar_t* /*end*/, const DfaState& /*state*/,
+		bool /*track_lines*/)
+{
+	return 0;
+}
+
+/* Append the positions of the new lines in [from, to) of the buffer. */
+template <typename T>
+void index_lines(const T* buffer, size_t from, size_t to,
+		std::vector<size_t>& lines)
+{
+	for (size_t i = from; i < to; i++)
+	{
+		if (buffer[i] == '\n')
+			lines.push_back(i);
+	}
+}
+
+inline void index_byte_lines(const unsigned char* buffer, size_t from,
+		size_t to, std::vector<size_t>& lines)
+{
+#ifdef LEXICAL_SSE2
+	const __m128i nl = _mm_set1_epi8('\n');
+	for (; to - from >= 16; from += 16)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*)(buffer + from));
+		unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(v, nl));
+		for (; mask; mask &= mask - 1)
+			lines.push_back(from + bit_scan(mask));
+	}
+#endif
+	for (; from < to; from++)
+	{
+		if (buffer[from] == '\n')
+			lines.push_back(from);
+	}
+}
+
+template <>
+void index_lines<char>(const char* buffer, size_t from, size_t to,
+		std::vector<size_t>& lines)
+{
+	index_byte_lines((const unsigned char*)buffer, from, to, lines);
+}
+
+template <>
+void index_lines<unsigned char>(const unsigned char* buffer, size_t from,
+		size_t to, std::vector<size_t>& lines)
+{
+	index_byte_lines(buffer, from, to, lines);
+}
+
+/* Read characters from a stream. Characters read from the stream are kept
+ * in the look ahead window of the environment, so rollback to the end of
+ * the last accepted token only need move the "cur" position, the stream
+ * itself will never be sought, even it is not seekable. */
+template <typename T>
+class StreamInput
+{
+public:
+	static const bool lines = true;
+	inline StreamInput(LexicalEnv<T>& env)
+	: _env(env), _start(env.cur)
+	{
+	}
+	inline bool get(T& ch)
+	{
+		size_t idx = _env.cur - _env.window_pos;
+		if (idx >= _env.window.size())
+		{
+			if (!fill())
+				return false;
+			idx = _env.cur - _env.window_pos;
+		}
+		ch = _env.window[idx];
+		if (ch == 0)
+			return false;
+		next_char(_env, ch);
+		return true;
+	}
+	inline void seek(size_t pos)
+	{
+		_env.cur = pos;
+	}
+	inline size_t skip(const DfaState& state)
+	{
+		size_t idx = _env.cur - _env.window_pos;
+		if (idx >= _env.window.size())
+			return 0;
+		const T* p = &_env.window[0];
+		return skip_loop(_env, p + idx, p + _env.window.size(), state, true);
+	}
+	inline const T* data(size_t /*pos*/) const
+	{
+		return 0;
+	}
+	inline void fill_str(Token<T>& token) const
+	{
+		token.str.assign(_env.window.begin() + (token.pos - _env.window_pos),
+				_env.window.begin() + (token.pos - _env.window_pos + token.length));
+	}
+private:
+	bool fill();
+	LexicalEnv<T>& _env;
+	// Where the current token begin, any characters before it
+	// will never be read again.
+	size_t _start;
+};
+
+template <typename T>
+bool StreamInput<T>::fill()
+{
+	typedef typename std::basic_streambuf<T>::traits_type traits_type;
+	std::basic_streambuf<T>* buf = _env.in->rdbuf();
+	if (!buf)
+		return false;
+	// Drop the characters that have been consumed, do it only when
+	// them occupied a half of the window to keep the cost low.
+	size_t consumed = _start - _env.window_pos;
+	if (consumed > 0 && consumed >= _env.window.size() / 2)
+	{
+		_env.window.erase(_env.window.begin(), _env.window.begin() + consumed);
+		_env.window_pos = _start;
+	}
+	// Wait for one character at least, then take the characters
+	// that can be read without blocking.
+	typename traits_type::int_type c = buf->sbumpc();
+	if (traits_type::eq_int_type(c, traits_type::eof()))
+	{
+		_env.in->setstate(ios::eofbit);
+		return false;
+	}
+	_env.window.push_back(traits_type::to_char_type(c));
+	std::streamsize avail = buf->in_avail();
+	if (avail > 0)
+	{
+		if (avail > LEXICAL_READ_SIZE)
+			avail = LEXICAL_READ_SIZE;
+		size_t size = _env.window.size();
+		_env.window.resize(size + (size_t)avail);
+		avail = buf->sgetn(&_env.window[size], avail);
+		_env.window.resize(size + (size_t)avail);
+	}
+	return true;
+}
+
+/* Read characters from a memory buffer, token only refer to the buffer
+ * and needn't to copy the characters. If 'Lines' is not set only the
+ * position is moved, the line and column are found by Scanner::locate(). */
+template <typename T, bool Lines = true>
+class BufferInput
+{
+public:
+	static const bool lines = Lines;
+	inline BufferInput(LexicalEnv<T>& env)
+	: _env(env)
+	{
+	}
+	inline bool get(T& ch)
+	{
+		const T* p = _env.buffer + _env.cur;
+		if (p >= _env.buffer_end || *p == 0)
+			return false;
+		ch = *p;
+		if (Lines)
+			next_char(_env, ch);
+		else
+			_env.cur++;
+		return true;
+	}
+	inline void seek(size_t pos)
+	{
+		_env.cur = pos;
+	}
+	inline size_t skip(const DfaState& state)
+	{
+		return skip_loop(_env, _env.buffer + _env.cur, _env.buffer_end, state, Lines);
+	}
+	inline const T* data(size_t pos) const
+	{
+		return _env.buffer + pos;
+	}
+	inline void fill_str(Token<T>& token) const
+	{
+		token.str.clear();
+	}
+private:
+	LexicalEnv<T>& _env;
+};
+
+/* Make the counters of the profile fit the lexical. */
+inline void prepare_profile(LexicalProfile* profile, const DfaData* data)
+{
+	if (profile->states.size() != data->state_count)
+		profile->states.assign(data->state_count, 0);
+	if (profile->actions.size() != data->action_info_count)
+		profile->actions.assign(data->action_info_count, 0);
+	if (profile->overshoots.size() != LEXICAL_PROFILE_OVERSHOOTS)
+		profile->overshoots.assign(LEXICAL_PROFILE_OVERSHOOTS, 0);
+}
+
+/* Add the counters of a profile to another one. */
+inline void merge_profile(LexicalProfile* profile, const LexicalProfile& other)
+{
+	profile->tokens += other.tokens;
+	profile->chars += other.chars;
+	profile->rollbacks += other.rollbacks;
+	if (profile->actions.size() < other.actions.size())
+		profile->actions.resize(other.actions.size(), 0);
+	for (size_t i = 0; i < other.actions.size(); i++)
+		profile->actions[i] += other.actions[i];
+	if (profile->overshoots.size() < other.overshoots.size())
+		profile->overshoots.resize(other.overshoots.size(), 0);
+	for (size_t i = 0; i < other.overshoots.size(); i++)
+		profile->overshoots[i] += other.overshoots[i];
+	if (profile->states.size() < other.states.size())
+		profile->states.resize(other.states.size(), 0);
+	for (size_t i = 0; i < other.states.size(); i++)
+		profile->states[i] += other.states[i];
+}
+
+/* Count a token, 'count' characters have been read for it. */
+template <typename T>
+inline void record_token(LexicalProfile* profile, const Token<T>& token,
+		size_t count)
+{
+#ifdef TLIB_LEX_PROFILE
+	if (!profile || token.length == 0)
+		return;
+	profile->tokens++;
+	profile->chars += count;
+	profile->actions[token.action]++;
+	size_t overshoot = count - token.length;
+	if (overshoot > 0)
+		profile->rollbacks++;
+	if (overshoot >= LEXICAL_PROFILE_OVERSHOOTS)
+		overshoot = LEXICAL_PROFILE_OVERSHOOTS - 1;
+	profile->overshoots[overshoot]++;
+#else
+	(void)profile;
+	(void)token;
+	(void)count;
+#endif
+}
+
+/* Scan a token from the input, "Input" is either StreamInput or BufferInput,
+ * "Table" is DenseTable, CombTable or LazyTable.
+ * Only the position informations of the token are filled. */
+template <typename T, typename Input, typename Table>
+void scan_token(void* lex_data, const Table& table, LexicalEnv<T>& env,
+		Input& input, bool best_match, Token<T>& token, LexicalProfile* profile)
+{
+	DfaData* data = (DfaData*)lex_data;
+	CharMap<T> char_map(data);
+
+	token.action = 0;
+	token.length = 0;
+	// The line is unknown if the input doesn't count it.
+	token.line = Input::lines ? env.line : 0;
+	token.line_pos = Input::lines ? env.line_pos : 0;
+	token.pos = env.cur;
+	token.data = input.data(env.cur);
+
+	unsigned int previous_final_line = env.line;
+	unsigned int previous_final_line_pos = env.line_pos;
+	// Characters have been read for this token.
+	size_t count = 0;
+#ifdef TLIB_LEX_PROFILE
+	if (profile)
+		prepare_profile(profile, data);
+#endif
+
+	T ch;
+	while (input.get(ch))
+	{
+		unsigned short in = char_map.map(ch);
+		unsigned int next = table.next(env.state, in);
+		count++;
+
+		if (next == table.dead)
+		{
+			if (token.action == 0)
+			{
+				if (best_match)
+					token.length = 1;
+				else
+					token.length = count;
+			}
+			if (token.length < count)
+			{
+				input.seek(token.pos + token.length);
+				if (Input::lines)
+				{
+					env.line = previous_final_line;
+					env.line_pos = previous_final_line_pos;
+				}
+			}
+			env.state = 0;
+			record_token(profile, token, count);
+			return;
+		}
+
+		const DfaState& state = table.state(next);
+		env.state = next;
+#ifdef TLIB_LEX_PROFILE
+		if (profile && next < profile->states.size())
+			profile->states[next]++;
+#endif
+		if (state.flags & DFA_STATE_FINAL)
+		{
+			token.length = count;
+			token.action = state.action;
+			if (state.flags & DFA_STATE_MINIMUM)
+			{
+				env.state = 0;
+				record_token(profile, token, count);
+				return;
+			}
+			if (Input::lines)
+			{
+				previous_final_line = env.line;
+				previous_final_line_pos = env.line_pos;
+			}
+		}
+		else if (Input::lines && count == 1)
+		{
+			previous_final_line = env.line;
+			previous_final_line_pos = env.line_pos;
+		}
+		if (state.flags & DFA_STATE_LOOP)
+		{
+			size_t skipped = input.skip(state);
+			count += skipped;
+#ifdef TLIB_LEX_PROFILE
+			if (profile && next < profile->states.size())
+				profile->states[next] += skipped;
+#endif
+			if (skipped && (state.flags & DFA_STATE_FINAL))
+			{
+				token.length = count;
+				if (Input::lines)
+				{
+					previous_final_line = env.line;
+					previous_final_line_pos = env.line_pos;
+				}
+			}
+		}
+	}
+	if (token.action == 0)
+	{
+		if (best_match && count > 1)
+			token.length = 1;
+		else
+			token.length = count;
+	}
+	if (token.length < count)
+	{
+		input.seek(token.pos + token.length);
+		if (Input::lines)
+		{
+			env.line = previous_final_line;
+			env.line_pos = previous_final_line_pos;
+		}
+	}
+	env.state = 0;
+	record_token(profile, token, count);
+}
+
+template <typename T, typename Input>
+class ScanToken
+{
+public:
+	inline ScanToken(void* lex_data, LexicalEnv<T>& env, bool best_match, Token<T>& token,
+			LexicalProfile* profile)
+	: _lex_data(lex_data), _env(env), _best_match(best_match), _token(token),
+	  _profile(profile)
+	{
+	}
+	template <typename Table>
+	inline void operator () (const Table& table)
+	{
+		Input input(_env);
+		scan_token(_lex_data, table, _env, input, _best_match, _token, _profile);
+		input.fill_str(_token);
+	}
+private:
+	void* _lex_data;
+	LexicalEnv<T>& _env;
+	bool _best_match;
+	Token<T>& _token;
+	LexicalProfile* _profile;
+};
+
+template <typename T>
+void Scanner<T>::next(Token<T>& token) throw(std::runtime_error)
+{
+	if (!_env.in && !_env.buffer)
+		throw std::runtime_error("No stream.");
+
+	if (!_data)
+		throw std::runtime_error("Not initialized.");
+
+	DfaData* data = (DfaData*)_data;
+	if (_env.buffer && lazy_lines)
+	{
+		ScanToken<T, BufferInput<T, false> > scan(_data, _env, best_match, token, profile_data());
+		dispatch_scan(data, _cache.get(), scan);
+	}
+	else if (_env.buffer)
+	{
+		ScanToken<T, BufferInput<T> > scan(_data, _env, best_match, token, profile_data());
+		dispatch_scan(data, _cache.get(), scan);
+	}
+	else
+	{
+		ScanToken<T, StreamInput<T> > scan(_data, _env, best_match, token, profile_data());
+		dispatch_scan(data, _cache.get(), scan);
+	}
+	ActionInfo* action_info = (ActionInfo*)((char*)_data + data->action_info_offset);
+	token.name = (const T*)((char*)_data + action_info[token.action].name_offset);
+	token.name_length = action_info[token.action].name_length;
+}
+
+template <typename T, typename Input>
+class ScanTokens
+{
+public:
+	inline ScanTokens(void* lex_data, LexicalEnv<T>& env, bool best_match,
+			TokenBatch& batch, size_t max, LexicalProfile* profile)
+	: count(0), _lex_data(lex_data), _env(env), _best_match(best_match),
+	  _batch(batch), _max(max), _profile(profile)
+	{
+	}
+	template <typename Table>
+	void operator () (const Table& table)
+	{
+		DfaData* data = (DfaData*)_lex_data;
+		ActionInfo* action_info = (ActionInfo*)((char*)_lex_data + data->action_info_offset);
+		Token<T> token;
+		while (count < _max)
+		{
+			Input input(_env);
+			scan_token(_lex_data, table, _env, input, _best_match, token, _profile);
+			if (token.length == 0)
+				break;
+			if (action_info[token.action].ignore)
+				continue;
+			_batch.action.push_back(token.action);
+			_batch.pos.push_back(token.pos);
+			_batch.length.push_back(token.length);
+			_batch.line.push_back(token.line);
+			_batch.line_pos.push_back(token.line_pos);
+			count++;
+		}
+	}
+	size_t count;
+private:
+	void* _lex_data;
+	LexicalEnv<T>& _env;
+	bool _best_match;
+	TokenBatch& _batch;
+	size_t _max;
+	LexicalProfile* _profile;
+};
+
+template <typename T>
+size_t Scanner<T>::next_tokens(TokenBatch& batch, size_t max) throw(std::runtime_error)
+{
+	if (!_env.in && !_env.buffer)
+		throw std::runtime_error("No stream.");
+
+	if (!_data)
+		throw std::runtime_error("Not initialized.");
+
+	batch.clear();
+	if (_env.buffer && lazy_lines)
+	{
+		ScanTokens<T, BufferInput<T, false> > scan(_data, _env, best_match, batch, max,
+				profile_data());
+		dispatch_scan((DfaData*)_data, _cache.get(), scan);
+		return scan.count;
+	}
+	else if (_env.buffer)
+	{
+		ScanTokens<T, BufferInput<T> > scan(_data, _env, best_match, batch, max,
+				profile_data());
+		dispatch_scan((DfaData*)_data, _cache.get(), scan);
+		return scan.count;
+	}
+	else
+	{
+		ScanTokens<T, StreamInput<T> > scan(_data, _env, best_match, batch, max,
+				profile_data());
+		dispatch_scan((DfaData*)_data, _cache.get(), scan);
+		return scan.count;
+	}
+}
+
+// Don't split the buffer into chunks smaller than this.
+#define LEXICAL_CHUNK_SIZE 65536
+// How far to look for a line end that a chunk begins after.
+#define LEXICAL_CHUNK_ALIGN 4096
+
+/* Tokens of a chunk scanned by a thread. */
 template <typename T>
-typename Lexical<T>::LexicalPtr Lexical<T>::create_by_bc_file(const std::string& filename)
-		throw(std::runtime_error)
+class Chunk
 {
-	ifstream infile(filename.c_str(), ios::in | ios::binary);
-	if (!infile.is_open())
-		throw runtime_error("Can't open file.");
+public:
+	void* lex_data;
+	// The lazy states, only one chunk is scanned if it is set.
+	LazyCache<T>* cache;
+	bool best_match;
+	LexicalEnv<T> env;
+	// Tokens (including the ignored) that begin before "end".
+	TokenBatch tokens;
+	// Counters of the chunk, 0 if the scanner doesn't profile.
+	LexicalProfile* profile;
+	size_t end;
+	// Reached the end of the buffer.
+	bool eof;
+	// Message of the exception thrown by the thread, empty if none.
+	std::string error;
+};
 
-	DfaData data;
-	infile.read((char*)&data, sizeof(DfaData));
-	if (infile.gcount() < (int)sizeof(DfaData))
+/* Scan tokens from the current position of the environment until a token
+ * begins at or beyond 'end', return false if reach the end of buffer. */
+template <typename T>
+class ScanChunk
+{
+public:
+	inline ScanChunk(void* lex_data, LexicalEnv<T>& env, bool best_match,
+			TokenBatch& batch, size_t end, LexicalProfile* profile)
+	: eof(false), _lex_data(lex_data), _env(env), _best_match(best_match),
+	  _batch(batch), _end(end), _profile(profile)
 	{
-		infile.close();
-		throw runtime_error("Invalid file format.");
 	}
-
-	if (!valid_dfa_data<T>(&data))
+	template <typename Table>
+	void operator () (const Table& table)
 	{
-		infile.close();
-		throw runtime_error("Invalid file format.");
+		Token<T> token;
+		while (_env.cur < _end)
+		{
+			BufferInput<T> input(_env);
+			scan_token(_lex_data, table, _env, input, _best_match, token, _profile);
+			if (token.length == 0)
+			{
+				eof = true;
+				break;
+			}
+			_batch.action.push_back(token.action);
+			_batch.pos.push_back(token.pos);
+			_batch.length.push_back(token.length);
+			_batch.line.push_back(token.line);
+			_batch.line_pos.push_back(token.line_pos);
+		}
 	}
+	bool eof;
+private:
+	void* _lex_data;
+	LexicalEnv<T>& _env;
+	bool _best_match;
+	TokenBatch& _batch;
+	size_t _end;
+	LexicalProfile* _profile;
+};
 
-	LexicalPtr lexical(new Lexical());
-	lexical->_data = malloc(data.data_size);
-	if (!lexical->_data)
+template <typename T>
+void scan_chunk(void* param)
+{
+	Chunk<T>& chunk = *(Chunk<T>*)param;
+	try
 	{
-		throw runtime_error("Out of memory.");
+		ScanChunk<T> scan(chunk.lex_data, chunk.env, chunk.best_match,
+				chunk.tokens, chunk.end, chunk.profile);
+		dispatch_scan((DfaData*)chunk.lex_data, chunk.cache, scan);
+		chunk.eof = scan.eof;
 	}
-	lexical->_allocated = true;
-	memcpy(lexical->_data, &data, data.header_size);
-
-	infile.read((char*)lexical->_data + data.header_size, data.data_size - data.header_size);
-	if (infile.gcount() < (int)(data.data_size - data.header_size))
+	catch (const std::bad_alloc&)
 	{
-		infile.close();
-		throw runtime_error("Invalid file format.");
+		chunk.error = "Out of memory.";
+	}
+	catch (const std::exception& e)
+	{
+		chunk.error = e.what();
+		if (chunk.error.empty())
+			chunk.error = "Unknown error.";
+	}
+	catch (...)
+	{
+		chunk.error = "Unknown error.";
 	}
-
-	return lexical;
 }
 
+/* Map the line and column scanned from the chunk start onto the real
+ * line and column of the position that the chunk met. */
+class LineMap
+{
+public:
+	inline LineMap(unsigned int chunk_line, unsigned int chunk_line_pos,
+			unsigned int line, unsigned int line_pos)
+	: _chunk_line(chunk_line), _chunk_line_pos(chunk_line_pos),
+	  _line(line), _line_pos(line_pos)
+	{
+	}
+	inline void map(unsigned int& line, unsigned int& line_pos) const
+	{
+		if (line == _chunk_line)
+			line_pos = line_pos - _chunk_line_pos + _line_pos;
+		line = line - _chunk_line + _line;
+	}
+private:
+	unsigned int _chunk_line;
+	unsigned int _chunk_line_pos;
+	unsigned int _line;
+	unsigned int _line_pos;
+};
 
 template <typename T>
-typename Lexical<T>::LexicalPtr Lexical<T>::create_by_bc(const void* data, unsigned long data_len)
-		throw(std::runtime_error)
+size_t Scanner<T>::tokenize(const T* input_buffer, size_t buffer_len,
+		TokenBatch& batch, unsigned int threads) throw(std::runtime_error)
 {
-	if (data_len < sizeof(DfaData))
-		throw runtime_error("Invalid data format.");
-
-	DfaData* dfa_data = (DfaData*)data;
-	if (!valid_dfa_data<T>(dfa_data))
-		throw runtime_error("Invalid data format.");
-
-	if (data_len < dfa_data->data_size)
-		throw runtime_error("Invalid data format.");
+	if (!input_buffer)
+		throw std::runtime_error("Invalid parameters.");
+	if (!_data)
+		throw std::runtime_error("Not initialized.");
 
-	LexicalPtr lexical(new Lexical());
-	lexical->_data = malloc(dfa_data->data_size);
-	if (!lexical->_data)
+	DfaData* data = (DfaData*)_data;
+	ActionInfo* action_info = (ActionInfo*)((char*)_data + data->action_info_offset);
+	size_t size = buffer_len;
+	if (threads == 0)
+		threads = get_cpu_count();
+	if (threads > size / LEXICAL_CHUNK_SIZE)
+		threads = (unsigned int)(size / LEXICAL_CHUNK_SIZE);
+	if (threads == 0 || _cache)
+		threads = 1;
+
+	// Begin the chunks after a line end if possible, it is more likely
+	// to be the beginning of a token.
+	std::vector<Chunk<T> > chunks(threads);
+	LexicalProfile* profile = profile_data();
+	std::vector<LexicalProfile> profiles(profile ? threads : 0);
+	size_t begin = 0;
+	for (unsigned int i = 0; i < threads; i++)
 	{
-		throw runtime_error("Out of memory.");
+		Chunk<T>& chunk = chunks[i];
+		size_t end = (i + 1 == threads) ? size : size / threads * (i + 1);
+		for (unsigned int j = 0; j < LEXICAL_CHUNK_ALIGN && end < size; j++)
+		{
+			if (input_buffer[end - 1] == '\n')
+				break;
+			end++;
+		}
+		chunk.lex_data = _data;
+		chunk.cache = _cache.get();
+		chunk.profile = profile ? &profiles[i] : 0;
+		chunk.best_match = best_match;
+		chunk.env.buffer = input_buffer;
+		chunk.env.buffer_end = input_buffer + size;
+		chunk.env.cur = begin;
+		chunk.end = end;
+		chunk.eof = false;
+		begin = end;
 	}
-	lexical->_allocated = true;
-	memcpy(lexical->_data, data, dfa_data->data_size);
-	return lexical;
+	{
+		// A thread joins when it is released, so the started threads are
+		// joined before the chunks are freed even if starting one throws.
+		std::vector<std::shared_ptr<Thread> > workers;
+		workers.reserve(threads);
+		for (unsigned int i = 1; i < threads; i++)
+			workers.push_back(std::shared_ptr<Thread>(new Thread(scan_chunk<T>, &chunks[i])));
+		scan_chunk<T>(&chunks[0]);
+		workers.clear();
+	}
+	for (unsigned int i = 0; i < profiles.size(); i++)
+		merge_profile(profile, profiles[i]);
+
+	// Take the tokens of the chunks from the position they meet the
+	// real tokens, scan again from the real position before that.
+	batch.clear();
+	LexicalEnv<T> env;
+	env.buffer = input_buffer;
+	env.buffer_end = input_buffer + size;
+	for (unsigned int i = 0; i < threads; i++)
+	{
+		Chunk<T>& chunk = chunks[i];
+		if (!chunk.error.empty())
+			throw std::runtime_error(chunk.error);
+		const TokenBatch& tokens = chunk.tokens;
+		while (env.cur < chunk.end)
+		{
+			size_t k = std::lower_bound(tokens.pos.begin(), tokens.pos.end(), env.cur)
+					- tokens.pos.begin();
+			if (k < tokens.size() && tokens.pos[k] == env.cur)
+			{
+				LineMap line_map(tokens.line[k], tokens.line_pos[k], env.line, env.line_pos);
+				for (; k < tokens.size(); k++)
+				{
+					if (action_info[tokens.action[k]].ignore)
+						continue;
+					unsigned int line = tokens.line[k];
+					unsigned int line_pos = tokens.line_pos[k];
+					line_map.map(line, line_pos);
+					batch.action.push_back(tokens.action[k]);
+					batch.pos.push_back(tokens.pos[k]);
+					batch.length.push_back(tokens.length[k]);
+					batch.line.push_back(line);
+					batch.line_pos.push_back(line_pos);
+				}
+				env.cur = chunk.env.cur;
+				env.line = chunk.env.line;
+				env.line_pos = chunk.env.line_pos;
+				line_map.map(env.line, env.line_pos);
+				if (chunk.eof)
+					return batch.size();
+				break;
+			}
+			TokenBatch token;
+			ScanChunk<T> scan(_data, env, best_match, token, env.cur + 1, profile);
+			dispatch_scan(data, _cache.get(), scan);
+			if (scan.eof)
+				return batch.size();
+			if (action_info[token.action[0]].ignore)
+				continue;
+			batch.action.push_back(token.action[0]);
+			batch.pos.push_back(token.pos[0]);
+			batch.length.push_back(token.length[0]);
+			batch.line.push_back(token.line[0]);
+			batch.line_pos.push_back(token.line_pos[0]);
+		}
+	}
+	return batch.size();
 }
+
+/* Move 'i' to the next position that a token can begin at or to a NUL,
+ * only the byte lexicals have the prefilter. */
 template <typename T>
-typename Lexical<T>::LexicalPtr Lexical<T>::create_by_static_bc(const void* data, unsigned long data_len)
-		throw(std::runtime_error)
+inline size_t skip_to_token(const SearchCache& /*search*/, const T* /*buffer*/,
+		size_t i, size_t /*size*/)
 {
-	if (data_len < sizeof(DfaData))
-		throw runtime_error("Invalid data format.");
-
-	DfaData* dfa_data = (DfaData*)data;
-	if (!valid_dfa_data<T>(dfa_data))
-		throw runtime_error("Invalid data format.");
-
-	if (data_len < dfa_data->data_size)
-		throw runtime_error("Invalid data format.");
-
-	LexicalPtr lexical(new Lexical());
-	lexical->_data = (void*)data;
-	lexical->_allocated = false;
-	return lexical;
+	return i;
 }
 
-template <typename T>
-void Lexical<T>::save_bc(const std::string& filename) throw(std::runtime_error)
+inline size_t skip_to_byte_token(const SearchCache& search,
+		const unsigned char* buffer, size_t i, size_t size)
 {
-	if (!_data)
-		throw std::runtime_error("Not initialized.");
-	ofstream outfile(filename.c_str(), ios::out | ios::binary);
-	if (!outfile.good())
-		throw runtime_error("Can't open file.");
-
-	DfaData* dfa_data = (DfaData*)_data;
-	outfile.write((char*)_data, dfa_data->data_size);
-	if (!outfile.good())
+	if (search.first.exit_count == 0)
+		return i;
+	const std::string& prefix = search.prefix;
+	unsigned int lines = 0;
+	const unsigned char* last = 0;
+	while (i < size)
 	{
-		outfile.close();
-		throw runtime_error("Write file error.");
+		i = find_exit<false>(buffer + i, buffer + size, search.first, lines, last) - buffer;
+		if (i >= size || buffer[i] == 0 || prefix.length() <= 1)
+			return i;
+		if (size - i < prefix.length())
+			return size;
+		if (memcmp(buffer + i, prefix.data(), prefix.length()) == 0)
+			return i;
+		i++;
 	}
-	outfile.close();
+	return i;
 }
 
+template <>
+inline size_t skip_to_token<char>(const SearchCache& search, const char* buffer,
+		size_t i, size_t size)
+{
+	return skip_to_byte_token(search, (const unsigned char*)buffer, i, size);
+}
 
-template <typename T>
-Lexical<T>::Lexical()
-: best_match(false), _data(0), _allocated(false)
+template <>
+inline size_t skip_to_token<unsigned char>(const SearchCache& search,
+		const unsigned char* buffer, size_t i, size_t size)
 {
-	reset();
+	return skip_to_byte_token(search, buffer, i, size);
 }
 
+/* Run the unanchored automaton until a token with action ends, the token
+ * must begin after the last time nothing is in flight, so only scan the
+ * tokens from there to find where it begins. */
 template <typename T>
-Lexical<T>::~Lexical()
+class ScanSearch
 {
-	if (_data && _allocated)
-		free(_data);
-}
+public:
+	inline ScanSearch(void* lex_data, SearchCache* search, LexicalEnv<T>& env,
+			LexicalProfile* profile)
+	: found(false), _lex_data(lex_data), _search(search), _env(env),
+	  _profile(profile)
+	{
+	}
+	template <typename Table>
+	void operator () (const Table& table)
+	{
+		const T* buffer = _env.buffer;
+		size_t size = _env.buffer_end - buffer;
+		size_t begin = _env.cur;
+		if (_search)
+		{
+			CharMap<T> char_map((DfaData*)_lex_data);
+			unsigned int state = 0;
+			size_t i = begin;
+			for (; i < size && buffer[i] != 0; i++)
+			{
+				if (state == 0)
+				{
+					i = skip_to_token(*_search, buffer, i, size);
+					if (i >= size || buffer[i] == 0)
+						break;
+					begin = i;
+				}
+				state = _search->next(table, state, char_map.map(buffer[i]));
+				if (_search->final(state))
+					break;
+			}
+			if (i >= size || buffer[i] == 0)
+				return;
+		}
+		for (size_t p = begin; p < size && buffer[p] != 0; p++)
+		{
+			_env.cur = p;
+			_env.state = 0;
+			BufferInput<T, false> input(_env);
+			scan_token(_lex_data, table, _env, input, true, token, _profile);
+			if (token.action != 0)
+			{
+				found = true;
+				return;
+			}
+		}
+	}
+	bool found;
+	Token<T> token;
+private:
+	void* _lex_data;
+	SearchCache* _search;
+	LexicalEnv<T>& _env;
+	LexicalProfile* _profile;
+};
 
 template <typename T>
-void Lexical<T>::parse(std::basic_istream<T>& input_stream) throw(std::runtime_error)
+bool Scanner<T>::search(const T* input_buffer, size_t buffer_len, size_t& pos,
+		size_t& length) throw(std::runtime_error)
 {
-	_env.in = &input_stream;
-	if (!_env.in)
-		throw std::runtime_error("Invalid parameters.");
-	_env.begin = _env.in->tellg();
-	reset();
+	if (!_data)
+		throw std::runtime_error("Not initialized.");
+	if (pos >= buffer_len)
+		return false;
+	DfaData* data = (DfaData*)_data;
+	// The lazy states are renumbered when flushed, so scan every position.
+	if (!_search && !_cache)
+	{
+		_search.reset(new SearchCache(data->input_count));
+		FindPrefilter<T> find(data, *_search);
+		dispatch_table(data, find);
+	}
+	LexicalEnv<T> env;
+	env.buffer = input_buffer;
+	env.buffer_end = input_buffer + buffer_len;
+	env.cur = pos;
+	ScanSearch<T> scan(_data, _search.get(), env, profile_data());
+	dispatch_scan(data, _cache.get(), scan);
+	if (!scan.found)
+		return false;
+	pos = scan.token.pos;
+	length = scan.token.length;
+	return true;
 }
 
 template <typename T>
-void Lexical<T>::parse(const T* input_string) throw(std::runtime_error)
+Action Scanner<T>::next_token(Token<T>& token) throw(std::runtime_error)
 {
-	std::basic_istringstream<T> iss(input_string);
-	parse(iss);
+	if (!_data)
+		throw std::runtime_error("Not initialized.");
+	DfaData* data = (DfaData*)_data;
+	ActionInfo* action_info = (ActionInfo*)((char*)_data + data->action_info_offset);
+	do
+	{
+		next(token);
+	}
+	while (action_info[token.action].ignore && token.length > 0);
+	return token.action;
 }
 
 template <typename T>
-void Lexical<T>::parse(const T* input_buffer, size_t buffer_len) throw(std::runtime_error)
+bool Scanner<T>::fetch_next(Token<T>& token) throw(std::runtime_error)
 {
-	std::basic_istringstream<T> iss(std::basic_string<T>(input_buffer, buffer_len));
-	parse(iss);
-}
+	if (next_token(token) == 0 && token.length == 0)
+		return false;
+	else
+		return true;
 
+}
 
 template <typename T>
-void Lexical<T>::reset()
+LexicalProfile* Scanner<T>::profile_data()
 {
-	if (_env.in)
-		_env.in->seekg(_env.begin, ios::beg);
-	_env.line = 1;
-	_env.line_pos = 1;
-	_env.cur = _env.begin;
-	reset_state();
+#ifdef TLIB_LEX_PROFILE
+	return &_profile;
+#else
+	return 0;
+#endif
 }
 
-
 template <typename T>
-inline T next_char(LexicalEnv<T>& env)
+void Scanner<T>::clear_profile()
 {
-	T ch = 0;
-	env.in->get(ch);
-	env.cur++;
-	if (ch == '\n')
-	{
-		env.line++;
-		env.line_pos = 1;
-	}
-	else
-		env.line_pos++;
-	return ch;
+	_profile.clear();
 }
 
+/* Name of the action in the profile output. */
 template <typename T> inline
-unsigned short map_char(unsigned short* char_map, T ch);
-template <> inline
-unsigned short map_char<char>(unsigned short* char_map, char ch)
+std::string profile_name(const T* name)
 {
-	return char_map[((int)ch) + 128];
+	return std::string(name, name + std::char_traits<T>::length(name));
 }
 template <> inline
-unsigned short map_char<unsigned char>(unsigned short* char_map, unsigned char ch)
+std::string profile_name<wchar_t>(const wchar_t* name)
 {
-	return char_map[(int)ch];
+	return wstring_to_utf8(name);
 }
-template <> inline
-unsigned short map_char<wchar_t>(unsigned short* char_map, wchar_t ch)
+
+inline std::string json_str(const std::string& str)
 {
-	return char_map[(int)ch];
+	std::string out = "\"";
+	for (size_t i = 0; i < str.length(); i++)
+	{
+		if (str[i] == '"' || str[i] == '\\')
+			out += '\\';
+		out += str[i];
+	}
+	return out + "\"";
 }
 
-
 template <typename T>
-void Lexical<T>::next(Token<T>& token) throw(std::runtime_error)
+void Scanner<T>::dump_profile(std::ostream& out, bool json) const
 {
-	if (!_env.in)
-		throw std::runtime_error("No stream.");
-
-	if (!_data)
-		throw std::runtime_error("Not initialized.");
-
 	DfaData* data = (DfaData*)_data;
-	unsigned short* char_map = (unsigned short*)((char*)_data + data->char_map_offset);
-	DfaTransit* transit_map = (DfaTransit*)((char*)_data + data->transit_map_offset);
 	ActionInfo* action_info = (ActionInfo*)((char*)_data + data->action_info_offset);
-
-	token.action = 0;
-	token.length = 0;
-	token.line = _env.line;
-	token.line_pos = _env.line_pos;
-	token.pos = _env.cur;
-	token.str.clear();
-
-	unsigned int previous_final_line = _env.line;
-	unsigned int previous_final_line_pos = _env.line_pos;
-
-	const DfaTransit* transit = 0;
-	T ch;
-	while ((ch = next_char(_env)) != 0)
+	const LexicalProfile& p = _profile;
+	if (json)
 	{
-		unsigned short input = map_char(char_map, ch);
-		transit = &transit_map[_env.state * data->transit_map_input_count + input];
-		token.str.push_back(ch);
-
-		if (transit->final_state)
-		{
-			// token.str.push_back(ch);
-			token.length = (unsigned int)token.str.length();
-			token.action = (Action)transit->action;
-			if (action_info[token.action].minimum)
-			{
-				token.name = (T*)((char*)_data + action_info[token.action].name_offset);
-				reset_state();
-				return;
-			}
-			else
-				_env.state = transit->state;
-
-			previous_final_line = _env.line;
-			previous_final_line_pos = _env.line_pos;
-		}
-		else
+		out << "{\"tokens\":" << p.tokens << ",\"chars\":" << p.chars
+			<< ",\"rollbacks\":" << p.rollbacks << ",\"actions\":[";
+		for (size_t i = 0; i < p.actions.size(); i++)
 		{
-			if (transit->state < data->transit_map_state_count)
-			{
-				// token.str.push_back(ch);
-				_env.state = transit->state;
-				if (token.str.length() == 1)
-				{
-					previous_final_line = _env.line;
-					previous_final_line_pos = _env.line_pos;
-				}
-			}
-			else
-			{
-				if (token.action == 0)
-				{
-					if (best_match)
-					{
-						token.length = 1;
-						_env.cur = token.pos + token.length;
-						token.str.resize(token.length);
-						_env.line = previous_final_line;
-						_env.line_pos = previous_final_line_pos;
-						_env.in->clear();
-						_env.in->seekg(_env.cur, ios::beg);
-					}
-					else
-					{
-						//token.str.push_back(ch);
-						token.length++;
-					}
-				}
-				else
-				{
-					_env.cur = token.pos + token.length;
-					token.str.resize(token.length);
-					_env.line = previous_final_line;
-					_env.line_pos = previous_final_line_pos;
-					_env.in->clear();
-					_env.in->seekg(_env.cur, ios::beg);
-				}
-				token.name = (T*)((char*)_data + action_info[token.action].name_offset);
-				reset_state();
-				return;
-			}
+			out << (i ? "," : "") << "{\"id\":" << i << ",\"name\":"
+				<< json_str(profile_name((T*)((char*)_data + action_info[i].name_offset)))
+				<< ",\"tokens\":" << p.actions[i] << "}";
 		}
+		out << "],\"overshoots\":[";
+		for (size_t i = 0; i < p.overshoots.size(); i++)
+			out << (i ? "," : "") << p.overshoots[i];
+		out << "],\"states\":[";
+		for (size_t i = 0; i < p.states.size(); i++)
+			out << (i ? "," : "") << p.states[i];
+		out << "]}" << std::endl;
+		return;
 	}
-	if (token.action == 0)
+	out << "tokens: " << p.tokens << std::endl
+		<< "chars: " << p.chars << std::endl
+		<< "rollbacks: " << p.rollbacks << std::endl
+		<< "actions:" << std::endl;
+	for (size_t i = 0; i < p.actions.size(); i++)
 	{
-		if (best_match && token.str.length() > 1)
-		{
-			token.length = 1;
-			_env.cur = token.pos + token.length;
-			token.str.resize(token.length);
-			_env.line = previous_final_line;
-			_env.line_pos = previous_final_line_pos;
-			_env.in->clear();
-			_env.in->seekg(_env.cur, ios::beg);
-		}
-		else
-		{
-			token.length = (unsigned int)token.str.length();
-		}
+		out << "  " << i << " "
+			<< profile_name((T*)((char*)_data + action_info[i].name_offset))
+			<< ": " << p.actions[i] << std::endl;
 	}
-	else
+	out << "overshoots:" << std::endl;
+	for (size_t i = 0; i < p.overshoots.size(); i++)
 	{
-		_env.cur = token.pos + token.length;
-		token.str.resize(token.length);
-		_env.line = previous_final_line;
-		_env.line_pos = previous_final_line_pos;
-		_env.in->clear();
-		_env.in->seekg(_env.cur, ios::beg);
+		if (p.overshoots[i] == 0)
+			continue;
+		out << "  " << i << (i + 1 == p.overshoots.size() ? "+" : "")
+			<< ": " << p.overshoots[i] << std::endl;
+	}
+	out << "states:" << std::endl;
+	for (size_t i = 0; i < p.states.size(); i++)
+	{
+		if (p.states[i] > 0)
+			out << "  " << i << ": " << p.states[i] << std::endl;
 	}
-	token.name = (T*)((char*)_data + action_info[token.action].name_offset);
-	reset_state();
-	return;
 }
 
 template <typename T>
-Action Lexical<T>::next_token(Token<T>& token) throw(std::runtime_error)
+void Scanner<T>::locate(size_t pos, unsigned int& line, unsigned int& line_pos)
+		throw(std::runtime_error)
 {
-	if (!_data)
-		throw std::runtime_error("Not initialized.");
-	DfaData* data = (DfaData*)_data;
-	ActionInfo* action_info = (ActionInfo*)((char*)_data + data->action_info_offset);
-	do
+	if (!_env.buffer)
+		throw std::runtime_error("No buffer.");
+	size_t size = _env.buffer_end - _env.buffer;
+	if (pos > size)
+		pos = size;
+	// Index the new lines only as far as needed.
+	if (pos > _indexed)
 	{
-		next(token);
+		index_lines(_env.buffer, _indexed, pos, _lines);
+		_indexed = pos;
 	}
-	while (action_info[token.action].ignore && token.length > 0);
-	return token.action;
+	size_t count = std::lower_bound(_lines.begin(), _lines.end(), pos) - _lines.begin();
+	line = (unsigned int)count + 1;
+	line_pos = (unsigned int)(count ? pos - _lines[count - 1] : pos + 1);
 }
 
 template <typename T>
-bool Lexical<T>::fetch_next(Token<T>& token) throw(std::runtime_error)
+Action Scanner<T>::get_named_action_id(const std::basic_string<T>& token_name) const
 {
-	if (next_token(token) == 0 && token.length == 0)
-		return false;
-	else
-		return true;
-
+	return _lexer->get_named_action_id(token_name);
 }
 
 template <typename T>
-Action Lexical<T>::get_named_action_id(const std::basic_string<T>& token_name) const
+Action CompiledLexer<T>::get_named_action_id(const std::basic_string<T>& token_name) const
 {
 	DfaData* dfa_data = (DfaData*)_data;
 	ActionInfo* action_info = (ActionInfo*)((char*)dfa_data + dfa_data->action_info_offset);
@@ -1146,10 +4274,68 @@ Action Lexical<T>::get_named_action_id(const std::basic_string<T>& token_name) c
 	return -1;
 }
 
+template <typename T>
+RegexSet<T>::RegexSet(const std::vector<std::basic_string<T> >& patterns,
+		unsigned long cache_size) throw(std::runtime_error)
+: _count(patterns.size())
+{
+	std::basic_string<T> lexical;
+	for (size_t i = 0; i < patterns.size(); i++)
+	{
+		if (patterns[i].find((T)'\n') != patterns[i].npos)
+			throw std::runtime_error("A pattern can't have a new line.");
+		lexical += (T)':';
+		lexical += patterns[i];
+		lexical += (T)'\n';
+	}
+	_lexer = CompiledLexer<T>::create_lazy(lexical, cache_size);
+	_cache.reset(new SetCache<T>(*_lexer->_lazy));
+	_found.assign(_count + 1, 0);
+}
+
+template <typename T>
+bool RegexSet<T>::match(const T* input_buffer, size_t buffer_len,
+		std::vector<unsigned int>& ids) throw(std::runtime_error)
+{
+	ids.clear();
+	CharMap<T> char_map((const DfaData*)_lexer->_data);
+	SetCache<T>& cache = *_cache;
+	unsigned int state = 0;
+	for (size_t i = 0; i < buffer_len && input_buffer[i] != 0; i++)
+	{
+		state = cache.next(state, char_map.map(input_buffer[i]));
+		const unsigned int* end = cache.matches_end(state);
+		for (const unsigned int* p = cache.matches_begin(state); p != end; p++)
+		{
+			if (_found[*p])
+				continue;
+			_found[*p] = 1;
+			// The action i is the pattern i - 1.
+			ids.push_back(*p - 1);
+		}
+		if (ids.size() == _count)
+			break;
+	}
+	for (size_t k = 0; k < ids.size(); k++)
+		_found[ids[k] + 1] = 0;
+	std::sort(ids.begin(), ids.end());
+	return !ids.empty();
+}
+
+
 
+template class CompiledLexer<char>;
+template class CompiledLexer<unsigned char>;
+template class CompiledLexer<wchar_t>;
+template class Scanner<char>;
+template class Scanner<unsigned char>;
+template class Scanner<wchar_t>;
 template class Lexical<char>;
 template class Lexical<unsigned char>;
 template class Lexical<wchar_t>;
+template class RegexSet<char>;
+template class RegexSet<unsigned char>;
+template class RegexSet<wchar_t>;
 
 
 } // End of namespace lex
@@ -24,6 +24,7 @@
 
 #include "range.h"
 #include <limits.h>
+#include <wchar.h>
 
 namespace tlib
 {
@@ -43,8 +44,14 @@ const Range<char> Range<char>::full_range =
 
 template <>
 const wchar_t Range<wchar_t>::full_min = 0;
+// Cover all of the Unicode code points if wchar_t can hold them.
+#if WCHAR_MAX > 0xFFFF
+template <>
+const wchar_t Range<wchar_t>::full_max = 0x10FFFF;
+#else
 template <>
 const wchar_t Range<wchar_t>::full_max = USHRT_MAX;
+#endif
 template <>
 const Range<wchar_t> Range<wchar_t>::empty_range = Range<wchar_t>();
 template <>
@@ -4,7 +4,7 @@
 #ifdef __alpha
 typedef unsigned int uint32;
 #else
-typedef unsigned long uint32;
+typedef unsigned int uint32;
 #endif
 
 struct MD5Context {
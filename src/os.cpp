@@ -41,6 +41,9 @@
 #    include <limits.h>
 #  else
 #    include <linux/limits.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <fcntl.h>
 #  endif
 #endif
 
@@ -137,4 +140,88 @@ std::string get_home_path() {
 		return "";
 }
 
+// Count of the online processors, at least 1.
+unsigned int get_cpu_count() {
+#if defined(__MSVC__) || defined(__MINGW32__)
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	unsigned int count = (unsigned int)info.dwNumberOfProcessors;
+#elif defined(__GNUC__)
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+#else
+#error "not implement..."
+#endif
+	if (count < 1)
+		return 1;
+	return (unsigned int)count;
+}
+
+unsigned long get_process_id() {
+#if defined(__MSVC__) || defined(__MINGW32__)
+	return (unsigned long)GetCurrentProcessId();
+#elif defined(__GNUC__)
+	return (unsigned long)getpid();
+#else
+#error "not implement..."
+#endif
+}
+
+// Map a whole file into memory for reading, return 0 if failed or the
+// file is empty.
+const void* map_file(const std::string& filename, unsigned long& size) {
+	size = 0;
+#if defined(__MSVC__) || defined(__MINGW32__)
+	HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+			0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+	if (file == INVALID_HANDLE_VALUE)
+		return 0;
+	DWORD high = 0;
+	DWORD low = GetFileSize(file, &high);
+	if (low == INVALID_FILE_SIZE || high != 0 || low == 0) {
+		CloseHandle(file);
+		return 0;
+	}
+	HANDLE mapping = CreateFileMappingA(file, 0, PAGE_READONLY, 0, 0, 0);
+	CloseHandle(file);
+	if (!mapping)
+		return 0;
+	// The view keeps the mapping alive.
+	const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (data)
+		size = low;
+	return data;
+#elif defined(__GNUC__)
+	int fd = open(filename.c_str(), O_RDONLY);
+	if (fd < 0)
+		return 0;
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size <= 0
+			|| (unsigned long long)st.st_size > (unsigned long)-1) {
+		close(fd);
+		return 0;
+	}
+	void* data = mmap(0, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return 0;
+	size = (unsigned long)st.st_size;
+	return data;
+#else
+#error "not implement..."
+#endif
+}
+
+// Release the memory returned by map_file().
+void unmap_file(const void* data, unsigned long size) {
+	if (!data)
+		return;
+#if defined(__MSVC__) || defined(__MINGW32__)
+	(void)size;
+	UnmapViewOfFile(data);
+#elif defined(__GNUC__)
+	munmap((void*)data, size);
+#endif
+}
+
 }
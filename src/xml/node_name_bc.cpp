@@ -1,277 +1,27 @@
 extern const unsigned char node_name_bc[] =
 {
-	 48,  0,  0,  0, 52,  1,  2,  0,  2,  0,  0,  0, 48,  0,  0,  0,
-	  0,  0,  1,  0, 48,  0,  2,  0,  2,  0,  0,  0,  9,  0,  0,  0,
-	  8,  1,  2,  0,  2,  0,  0,  0, 24,  1,  2,  0, 28,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  8,  0,  8,  0,  8,  0,  8,  0,  8,  0,  1,  0,  1,  0,
+	 84, 76, 69, 88,  5,  0,  0,  0, 88,  0,  0,  0,  8,  7,  0,  0,
+	  2,  0,  0,  0, 88,  0,  0,  0, 48,  3,  0,  0, 88,  4,  0,  0,
+	  2,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,184,  6,  0,  0,
+	  0,  0,  0,  0,200,  6,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,
+	  0,  0,  0,  0,  0,  0,  0,  0,220,  6,  0,  0,  2,  0,  0,  0,
+	236,  6,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  8,  0,  8,  0,
+	  8,  0,  8,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
 	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
-	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
-	  8,  0,  8,  0,  8,  0,  8,  0,  2,  0,  8,  0,  8,  0,  8,  0,
-	  8,  0,  8,  0,  8,  0,  8,  0,  8,  0,  3,  0,  3,  0,  8,  0,
-	  4,  0,  4,  0,  4,  0,  4,  0,  4,  0,  4,  0,  4,  0,  4,  0,
-	  4,  0,  4,  0,  4,  0,  8,  0,  8,  0,  8,  0,  8,  0,  8,  0,
-	  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  8,  0,  8,  0,  8,  0,  8,  0,
+	  2,  0,  8,  0,  8,  0,  8,  0,  8,  0,  8,  0,  8,  0,  8,  0,
+	  8,  0,  3,  0,  3,  0,  8,  0,  4,  0,  4,  0,  4,  0,  4,  0,
+	  4,  0,  4,  0,  4,  0,  4,  0,  4,  0,  4,  0,  4,  0,  8,  0,
+	  8,  0,  8,  0,  8,  0,  8,  0,  5,  0,  5,  0,  5,  0,  5,  0,
 	  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,
 	  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,
-	  5,  0,  5,  0,  5,  0,  8,  0,  8,  0,  8,  0,  8,  0,  6,  0,
+	  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  8,  0,
+	  8,  0,  8,  0,  8,  0,  6,  0,  6,  0,  6,  0,  6,  0,  6,  0,
 	  6,  0,  6,  0,  6,  0,  6,  0,  6,  0,  6,  0,  6,  0,  6,  0,
 	  6,  0,  6,  0,  6,  0,  6,  0,  6,  0,  6,  0,  6,  0,  6,  0,
-	  6,  0,  6,  0,  6,  0,  6,  0,  6,  0,  6,  0,  6,  0,  6,  0,
-	  6,  0,  6,  0,  6,  0,  8,  0,  8,  0,  8,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
+	  6,  0,  6,  0,  6,  0,  6,  0,  6,  0,  6,  0,  6,  0,  8,  0,
+	  8,  0,  8,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
 	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
 	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
 	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
@@ -319,7898 +69,49 @@ extern const unsigned char node_name_bc[] =
 	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
 	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
 	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,  7,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
-	  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,  1,  2,  0,
-	  0,  0,  0,  0, 48,  1,  2,  0,101,  0,  0,  0,114,  0,  0,  0,
-	114,  0,  0,  0,111,  0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0
+	  7,  0,  7,  0,  7,  0,  7,  0,  0,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  0,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  1,  0,  1,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,
+	  2,  1,  1,  1,  1,  1,  1,  1,  1,  2,  0,  0,  0,  0,  5,  0,
+	236,  6,  0,  0,  0,  0,  0,  0,  4,  7,  0,  0,101,  0,  0,  0,
+	114,  0,  0,  0,114,  0,  0,  0,111,  0,  0,  0,114,  0,  0,  0,
+	  0,  0,  0,  0,  0,  0,  0,  0
 };
-extern const unsigned int node_name_bc_length = 131380;
+extern const unsigned int node_name_bc_length = 1800;
@@ -1,278 +1,27 @@
 extern const unsigned char path_bc[] =
 {
-	 48,  0,  0,  0,212, 46,  2,  0,  2,  0,  0,  0, 48,  0,  0,  0,
-	  0,  0,  1,  0, 48,  0,  2,  0, 26,  0,  0,  0, 37,  0,  0,  0,
-	 72, 45,  2,  0, 11,  0,  0,  0,160, 45,  2,  0, 52,  1,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  1,  0,  2,  0,  3,  0,  3,  0,  4,  0,  5,  0,  5,  0,
-	  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,
+	 84, 76, 69, 88,  5,  0,  0,  0, 88,  0,  0,  0,  4, 13,  0,  0,
+	  2,  0,  0,  0, 88,  0,  0,  0, 48,  3,  0,  0, 88,  4,  0,  0,
+	 27,  0,  0,  0, 37,  0,  0,  0,  1,  0,  0,  0,184,  6,  0,  0,
+	  0,  0,  0,  0,144,  7,  0,  0,231,  3,  0,  0,  0,  0,  0,  0,
+	  0,  0,  0,  0,  0,  0,  0,  0,120, 11,  0,  0, 11,  0,  0,  0,
+	208, 11,  0,  0, 52,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  2,  0,  3,  0,
+	  3,  0,  4,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,
 	  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,  5,  0,
-	  6,  0,  7,  0,  8,  0,  9,  0, 10,  0, 11,  0, 11,  0, 12,  0,
-	 13,  0, 14,  0, 15,  0, 16,  0, 16,  0, 17,  0, 18,  0, 19,  0,
-	 20,  0, 20,  0, 20,  0, 20,  0, 20,  0, 20,  0, 20,  0, 20,  0,
-	 20,  0, 20,  0, 21,  0, 22,  0, 22,  0, 22,  0, 22,  0, 22,  0,
-	 23,  0, 24,  0, 24,  0, 24,  0, 24,  0, 24,  0, 24,  0, 24,  0,
+	  5,  0,  5,  0,  5,  0,  5,  0,  6,  0,  7,  0,  8,  0,  9,  0,
+	 10,  0, 11,  0, 11,  0, 12,  0, 13,  0, 14,  0, 15,  0, 16,  0,
+	 16,  0, 17,  0, 18,  0, 19,  0, 20,  0, 20,  0, 20,  0, 20,  0,
+	 20,  0, 20,  0, 20,  0, 20,  0, 20,  0, 20,  0, 21,  0, 22,  0,
+	 22,  0, 22,  0, 22,  0, 22,  0, 23,  0, 24,  0, 24,  0, 24,  0,
 	 24,  0, 24,  0, 24,  0, 24,  0, 24,  0, 24,  0, 24,  0, 24,  0,
 	 24,  0, 24,  0, 24,  0, 24,  0, 24,  0, 24,  0, 24,  0, 24,  0,
-	 24,  0, 24,  0, 24,  0, 25,  0, 26,  0, 27,  0, 28,  0, 29,  0,
-	 30,  0, 31,  0, 31,  0, 31,  0, 31,  0, 31,  0, 31,  0, 31,  0,
+	 24,  0, 24,  0, 24,  0, 24,  0, 24,  0, 24,  0, 24,  0, 25,  0,
+	 26,  0, 27,  0, 28,  0, 29,  0, 30,  0, 31,  0, 31,  0, 31,  0,
 	 31,  0, 31,  0, 31,  0, 31,  0, 31,  0, 31,  0, 31,  0, 31,  0,
 	 31,  0, 31,  0, 31,  0, 31,  0, 31,  0, 31,  0, 31,  0, 31,  0,
-	 31,  0, 31,  0, 31,  0, 32,  0, 33,  0, 34,  0, 34,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
+	 31,  0, 31,  0, 31,  0, 31,  0, 31,  0, 31,  0, 31,  0, 32,  0,
+	 33,  0, 34,  0, 34,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
 	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
 	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
 	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
@@ -320,8608 +69,126 @@ extern const unsigned char path_bc[] =
 	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
 	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
 	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0, 35,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  2,  0,  0,  0, 10,  0,  0,  0,  1,  0,  0,  0,  2,  0,  0,  0,
-	 10,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  2,  0,  0,  0, 10,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  2,  0,  0,  0,
-	 10,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  3,  0,  0,  0,  1,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  5,  0,  0,  0,  7,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  7,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
-	  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  7,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  7,  0,  0,  0,  1,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  3,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  2,  0,  0,  0, 10,  0,  0,  0,
-	  1,  0,  0,  0,  2,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  2,  0,  0,  0,
-	 10,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  2,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  3,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 10,  0,  0,  0,
-	  2,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 10,  0,  0,  0,  2,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 10,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  3,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 10,  0,  0,  0,  2,  0,  0,  0,
-	  1,  0,  0,  0, 10,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 10,  0,  0,  0,
-	  2,  0,  0,  0,  1,  0,  0,  0, 10,  0,  0,  0,  2,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 10,  0,  0,  0,
-	  2,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 10,  0,  0,  0,  2,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 10,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 10,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  7,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  7,  0,  0,  0,  1,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  7,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  7,  0,  0,  0,
-	  1,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  3,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  3,  0,  0,  0,  3,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 10,  0,  0,  0,
-	  2,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 10,  0,  0,  0,  2,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 10,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 10,  0,  0,  0,  2,  0,  0,  0,
-	  1,  0,  0,  0, 10,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 10,  0,  0,  0,
-	  2,  0,  0,  0,  1,  0,  0,  0, 10,  0,  0,  0,  2,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 10,  0,  0,  0,
-	  2,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 10,  0,  0,  0,  2,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 10,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 10,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 15,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 16,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 22,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 19,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 15,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 16,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 19,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 24,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 22,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160, 45,  2,  0,
-	  0,  0,  0,  0,184, 45,  2,  0,  0,  0,  0,  0,216, 45,  2,  0,
-	  0,  0,  0,  0,  0, 46,  2,  0,  0,  0,  0,  0, 36, 46,  2,  0,
-	  0,  0,  0,  0, 56, 46,  2,  0,  0,  0,  0,  0, 84, 46,  2,  0,
-	  0,  0,  0,  0,124, 46,  2,  0,  0,  0,  0,  0,148, 46,  2,  0,
-	  0,  0,  0,  0,176, 46,  2,  0,  0,  1,  0,  0,188, 46,  2,  0,
+	 35,  0, 35,  0, 35,  0, 35,  0,  0,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  0,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  1,  0,  1,  0,  0,  0,  0,  0, 10,  0,  1,  0,  0,  0,  0,  0,
+	  1,  0,  1,  0,  0,  0,  0,  0,  7,  0,  1,  0,  0,  0,  0,  0,
+	  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,  0,  0,
+	  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  1,  0,  0,  0,  0,  0,
+	  8,  0,  1,  0,  0,  0,  0,  0,  2,  0,  1,  0,  0,  0,  0,  0,
+	  2,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  6,  0,  1,  0,  0,  0,  0,  0,  3,  0,  1,  0,  0,  0,  0,  0,
+	  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  6,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  6,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  6,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  1,  2,  2, 27,  2,  1,  2, 27, 27, 27,  1, 27, 27, 27, 27,  3,
+	 27,  1,  1,  4,  1,  1, 27,  5,  6,  7, 27, 27, 27,  6, 27,  6,
+	 27,  8, 27,  1, 27,  1, 27, 27, 27, 27,  1, 27, 27, 27, 27,  1,
+	 27, 27, 27, 27, 27, 27,  1,  1, 27,  1,  1, 27, 27,  1, 27, 27,
+	 27, 27,  1, 27,  1, 27, 27, 27,  1, 27, 27,  2,  2, 27,  2, 27,
+	  2, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 27, 27,  9, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 27, 27, 27, 27, 10, 27, 27, 27, 27, 10, 27,
+	 27, 27, 27, 10, 27, 27, 27, 27, 11, 27, 10, 10, 27, 10, 10, 27,
+	 27, 10, 27, 27, 27, 27, 10, 27, 10, 27, 27, 27, 10, 27,  1, 27,
+	 27, 27, 27,  1, 27, 27, 27, 27,  1, 27, 27, 12, 27, 27, 27,  1,
+	  1, 27,  6,  1, 27, 27,  6, 27, 27, 27, 27,  6, 27,  6, 27, 27,
+	 27,  1, 27,  7,  7,  7,  7,  7,  7,  7,  7, 13,  7,  7,  7, 14,
+	  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 27,  7, 15,  7,
+	  7,  7,  7,  7,  7,  7,  7, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 27, 10, 27, 27, 27, 27, 10, 27, 27, 27, 27, 10, 27, 27, 27,
+	 27, 27, 27, 10, 10, 27, 10, 10, 27, 27, 10, 27, 27, 27, 27, 10,
+	 27, 10, 27, 27, 27, 10, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 16, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 17, 13, 13,
+	 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 18, 13, 19, 13, 13, 13,
+	 13, 13, 13, 13, 13, 27, 14, 14, 14, 14, 14, 14, 14, 14, 17, 14,
+	 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 20,
+	 14, 21, 14, 14, 14, 14, 14, 14, 14, 14, 27, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	 27, 27, 27, 27, 27, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 22, 17,
+	 23, 17, 17, 17, 17, 17, 17, 17, 17, 27, 18, 18, 18, 18, 18, 18,
+	 18, 18,  7, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	 18, 18, 18, 18, 24, 18, 18, 18, 18, 18, 18, 18, 18, 18, 27, 18,
+	 18, 18, 18, 18, 18, 18, 18,  7, 18, 18, 18, 18, 18, 18, 18, 18,
+	 18, 18, 18, 18, 18, 18, 18, 18, 18, 24, 18, 18, 18, 18, 18, 18,
+	 18, 18, 18, 27, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	  7, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 25, 20,
+	 20, 20, 20, 20, 20, 20, 20, 20, 27, 20, 20, 20, 20, 20, 20, 20,
+	 20, 20, 20, 20, 20,  7, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	 20, 20, 20, 25, 20, 20, 20, 20, 20, 20, 20, 20, 20, 27, 22, 22,
+	 22, 22, 22, 22, 22, 22, 14, 22, 22, 22, 13, 22, 22, 22, 22, 22,
+	 22, 22, 22, 22, 22, 22, 22, 22, 26, 22, 22, 22, 22, 22, 22, 22,
+	 22, 22, 27, 22, 22, 22, 22, 22, 22, 22, 22, 14, 22, 22, 22, 13,
+	 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 26, 22, 22,
+	 22, 22, 22, 22, 22, 22, 22, 27, 18, 18, 18, 18, 18, 18, 18, 18,
+	 13, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	 18, 18, 24, 18, 18, 18, 18, 18, 18, 18, 18, 18, 27, 20, 20, 20,
+	 20, 20, 20, 20, 20, 20, 20, 20, 20, 14, 20, 20, 20, 20, 20, 20,
+	 20, 20, 20, 20, 20, 20, 20, 25, 20, 20, 20, 20, 20, 20, 20, 20,
+	 20, 27, 22, 22, 22, 22, 22, 22, 22, 22, 17, 22, 22, 22, 17, 22,
+	 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 26, 22, 22, 22,
+	 22, 22, 22, 22, 22, 22, 27,  0,  0,  0,  5,  0,208, 11,  0,  0,
+	  0,  0,  7,  0,232, 11,  0,  0,  0,  0,  9,  0,  8, 12,  0,  0,
+	  0,  0,  8,  0, 48, 12,  0,  0,  0,  0,  4,  0, 84, 12,  0,  0,
+	  0,  0,  6,  0,104, 12,  0,  0,  0,  0,  9,  0,132, 12,  0,  0,
+	  0,  0,  5,  0,172, 12,  0,  0,  0,  0,  6,  0,196, 12,  0,  0,
+	  0,  0,  2,  0,224, 12,  0,  0,  0,  1,  5,  0,236, 12,  0,  0,
 	101,  0,  0,  0,114,  0,  0,  0,114,  0,  0,  0,111,  0,  0,  0,
 	114,  0,  0,  0,  0,  0,  0,  0,101,  0,  0,  0,108,  0,  0,  0,
 	101,  0,  0,  0,109,  0,  0,  0,101,  0,  0,  0,110,  0,  0,  0,
@@ -8943,4 +210,4 @@ extern const unsigned char path_bc[] =
 	112,  0,  0,  0, 97,  0,  0,  0, 99,  0,  0,  0,101,  0,  0,  0,
 	  0,  0,  0,  0
 };
-extern const unsigned int path_bc_length = 143060;
+extern const unsigned int path_bc_length = 3332;
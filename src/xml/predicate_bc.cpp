@@ -1,278 +1,27 @@
 extern const unsigned char predicate_bc[] =
 {
-	 48,  0,  0,  0,208, 74,  2,  0,  2,  0,  0,  0, 48,  0,  0,  0,
-	  0,  0,  1,  0, 48,  0,  2,  0, 41,  0,  0,  0, 38,  0,  0,  0,
-	 56, 73,  2,  0, 16,  0,  0,  0,184, 73,  2,  0, 24,  1,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  1,  0,  2,  0,  2,  0,  2,  0,  2,  0,  3,  0,  3,  0,
-	  3,  0,  3,  0,  3,  0,  3,  0,  3,  0,  3,  0,  3,  0,  3,  0,
+	 84, 76, 69, 88,  5,  0,  0,  0, 88,  0,  0,  0,200, 14,  0,  0,
+	  2,  0,  0,  0, 88,  0,  0,  0, 48,  3,  0,  0, 88,  4,  0,  0,
+	 36,  0,  0,  0, 38,  0,  0,  0,  1,  0,  0,  0,184,  6,  0,  0,
+	  0,  0,  0,  0,216,  7,  0,  0, 88,  5,  0,  0,  0,  0,  0,  0,
+	  0,  0,  0,  0,  0,  0,  0,  0, 48, 13,  0,  0, 16,  0,  0,  0,
+	176, 13,  0,  0, 24,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  2,  0,  2,  0,
+	  2,  0,  2,  0,  3,  0,  3,  0,  3,  0,  3,  0,  3,  0,  3,  0,
 	  3,  0,  3,  0,  3,  0,  3,  0,  3,  0,  3,  0,  3,  0,  3,  0,
-	  4,  0,  5,  0,  6,  0,  7,  0,  8,  0,  9,  0, 10,  0, 11,  0,
-	 12,  0, 13,  0, 14,  0, 14,  0, 14,  0, 15,  0, 16,  0, 17,  0,
-	 18,  0, 18,  0, 18,  0, 18,  0, 18,  0, 18,  0, 18,  0, 18,  0,
-	 18,  0, 18,  0, 19,  0, 20,  0, 21,  0, 22,  0, 23,  0, 24,  0,
-	 25,  0, 26,  0, 26,  0, 26,  0, 26,  0, 26,  0, 26,  0, 26,  0,
+	  3,  0,  3,  0,  3,  0,  3,  0,  4,  0,  5,  0,  6,  0,  7,  0,
+	  8,  0,  9,  0, 10,  0, 11,  0, 12,  0, 13,  0, 14,  0, 14,  0,
+	 14,  0, 15,  0, 16,  0, 17,  0, 18,  0, 18,  0, 18,  0, 18,  0,
+	 18,  0, 18,  0, 18,  0, 18,  0, 18,  0, 18,  0, 19,  0, 20,  0,
+	 21,  0, 22,  0, 23,  0, 24,  0, 25,  0, 26,  0, 26,  0, 26,  0,
 	 26,  0, 26,  0, 26,  0, 26,  0, 26,  0, 26,  0, 26,  0, 26,  0,
 	 26,  0, 26,  0, 26,  0, 26,  0, 26,  0, 26,  0, 26,  0, 26,  0,
-	 26,  0, 26,  0, 26,  0, 27,  0, 28,  0, 29,  0, 29,  0, 30,  0,
-	 31,  0, 32,  0, 32,  0, 32,  0, 32,  0, 32,  0, 32,  0, 32,  0,
+	 26,  0, 26,  0, 26,  0, 26,  0, 26,  0, 26,  0, 26,  0, 27,  0,
+	 28,  0, 29,  0, 29,  0, 30,  0, 31,  0, 32,  0, 32,  0, 32,  0,
 	 32,  0, 32,  0, 32,  0, 32,  0, 32,  0, 32,  0, 32,  0, 32,  0,
 	 32,  0, 32,  0, 32,  0, 32,  0, 32,  0, 32,  0, 32,  0, 32,  0,
-	 32,  0, 32,  0, 32,  0, 33,  0, 34,  0, 35,  0, 35,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
+	 32,  0, 32,  0, 32,  0, 32,  0, 32,  0, 32,  0, 32,  0, 33,  0,
+	 34,  0, 35,  0, 35,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
 	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
 	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
 	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
@@ -320,9074 +69,173 @@ extern const unsigned char predicate_bc[] =
 	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
 	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
 	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0, 36,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,
-	  2,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,
-	  1,  0,  0,  0,  2,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,
-	  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  7,  0,  0,  0,  5,  0,  0,  0,  1,  0,  0,  0,
-	  7,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  8,  0,  0,  0,  4,  0,  0,  0,
-	  1,  0,  0,  0,  9,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,
-	 10,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,  8,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 11,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,  7,  0,  0,  0,
-	 13,  0,  0,  0,  1,  0,  0,  0, 12,  0,  0,  0, 11,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 13,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 14,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 14,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 14,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  2,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  2,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  7,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  7,  0,  0,  0,
-	  3,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  7,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  7,  0,  0,  0,  3,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,
-	  1,  0,  0,  0,  9,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 16,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  8,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  9,  0,  0,  0,  2,  0,  0,  0,  1,  0,  0,  0,
-	  1,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,
-	  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,
-	 22,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0, 21,  0,  0,  0,
-	  4,  0,  0,  0,  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 23,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 24,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 24,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 24,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  7,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  7,  0,  0,  0,
-	 12,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 28,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 28,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 28,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 28,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0, 28,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 28,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,
-	 28,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 28,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 28,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 28,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 28,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 16,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 14,  0,  0,  0,
-	  4,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 14,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 14,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 14,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  1,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0,  7,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,
-	  1,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 35,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 36,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 37,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 37,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 37,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 18,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  7,  0,  0,  0,
-	  3,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 20,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  7,  0,  0,  0,  3,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 21,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 21,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 21,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 21,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0, 21,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,
-	 21,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 21,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 21,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,
-	  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 21,  0,  0,  0,
-	  4,  0,  0,  0,  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 23,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 24,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 24,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 24,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 29,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 29,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 29,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 29,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0, 29,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 29,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,
-	 29,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 29,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 29,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 29,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 29,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,
-	  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 27,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 24,  0,  0,  0,
-	  4,  0,  0,  0,  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 24,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 24,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 24,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 21,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0,  7,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  7,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 30,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,
-	 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 33,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 33,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 33,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 28,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 28,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 28,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 28,  0,  0,  0,  4,  0,  0,  0,
-	  1,  0,  0,  0, 28,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 28,  0,  0,  0,
-	  4,  0,  0,  0,  1,  0,  0,  0, 28,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 28,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 28,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 28,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 28,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 29,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 29,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 29,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 29,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0, 29,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 29,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,
-	 29,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 29,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 29,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 29,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 29,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,
-	  1,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 27,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 30,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,
-	 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 33,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 33,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 33,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 39,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 39,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 39,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 39,  0,  0,  0,  4,  0,  0,  0,
-	  1,  0,  0,  0, 39,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 39,  0,  0,  0,
-	  4,  0,  0,  0,  1,  0,  0,  0, 39,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 39,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 39,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 39,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 39,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 34,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 30,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 33,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,
-	 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 33,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 33,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 33,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  7,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 30,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,
-	 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 37,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 37,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 37,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 40,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 40,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 40,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 40,  0,  0,  0,  4,  0,  0,  0,
-	  1,  0,  0,  0, 40,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 40,  0,  0,  0,
-	  4,  0,  0,  0,  1,  0,  0,  0, 40,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 40,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 40,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 40,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 40,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 30,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 37,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,
-	 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 37,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 37,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 37,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 30,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	  7,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 39,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 39,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 39,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
-	 39,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0, 39,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 39,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,
-	 39,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 39,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 39,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 39,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 39,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 40,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 40,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 40,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  1,  0,  0,  0, 40,  0,  0,  0,  4,  0,  0,  0,
-	  1,  0,  0,  0, 40,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 40,  0,  0,  0,
-	  4,  0,  0,  0,  1,  0,  0,  0, 40,  0,  0,  0,  4,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 40,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 40,  0,  0,  0,
-	  4,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 40,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,
-	  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
-	  1,  0,  0,  0, 40,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
-	 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,184, 73,  2,  0,
-	  0,  0,  0,  0,208, 73,  2,  0,  0,  0,  0,  0,240, 73,  2,  0,
-	  0,  0,  0,  0,  8, 74,  2,  0,  0,  0,  0,  0, 36, 74,  2,  0,
-	  0,  0,  0,  0, 56, 74,  2,  0,  0,  0,  0,  0, 68, 74,  2,  0,
-	  0,  0,  0,  0, 80, 74,  2,  0,  0,  0,  0,  0, 96, 74,  2,  0,
-	  0,  0,  0,  0,108, 74,  2,  0,  0,  0,  0,  0,120, 74,  2,  0,
-	  0,  0,  0,  0,132, 74,  2,  0,  0,  0,  0,  0,144, 74,  2,  0,
-	  0,  0,  0,  0,156, 74,  2,  0,  0,  0,  0,  0,168, 74,  2,  0,
-	  0,  1,  0,  0,184, 74,  2,  0,101,  0,  0,  0,114,  0,  0,  0,
-	114,  0,  0,  0,111,  0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,
-	105,  0,  0,  0,110,  0,  0,  0,116,  0,  0,  0,101,  0,  0,  0,
-	103,  0,  0,  0,101,  0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,
-	102,  0,  0,  0,108,  0,  0,  0,111,  0,  0,  0, 97,  0,  0,  0,
-	116,  0,  0,  0,  0,  0,  0,  0,115,  0,  0,  0,116,  0,  0,  0,
-	114,  0,  0,  0,105,  0,  0,  0,110,  0,  0,  0,103,  0,  0,  0,
-	  0,  0,  0,  0,112,  0,  0,  0, 97,  0,  0,  0,116,  0,  0,  0,
-	104,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0,112,  0,  0,  0,
-	  0,  0,  0,  0,114,  0,  0,  0,112,  0,  0,  0,  0,  0,  0,  0,
-	 97,  0,  0,  0,110,  0,  0,  0,100,  0,  0,  0,  0,  0,  0,  0,
-	111,  0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0,
-	115,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0,113,  0,  0,  0,
-	  0,  0,  0,  0,109,  0,  0,  0,101,  0,  0,  0,  0,  0,  0,  0,
-	109,  0,  0,  0,113,  0,  0,  0,  0,  0,  0,  0,101,  0,  0,  0,
-	113,  0,  0,  0,  0,  0,  0,  0,110,  0,  0,  0,101,  0,  0,  0,
-	113,  0,  0,  0,  0,  0,  0,  0,115,  0,  0,  0,112,  0,  0,  0,
-	 97,  0,  0,  0, 99,  0,  0,  0,101,  0,  0,  0,  0,  0,  0,  0
+	 36,  0, 36,  0, 36,  0, 36,  0,  0,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  0,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	  1,  0,  1,  0,  1,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  4,  0,  1,  0,  0,  0,  0,  0, 15,  0,  1,  0,  0,  0,  0,  0,
+	  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  5,  0,  1,  0,  0,  0,  0,  0,  6,  0,  1,  0,  0,  0,  0,  0,
+	  4,  0,  1,  0,  0,  0,  0,  0,  4,  0,  1,  0,  0,  0,  0,  0,
+	  4,  0,  1,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,  0,  0,
+	  9,  0,  1,  0,  0,  0,  0,  0, 13,  0,  1,  0,  0,  0,  0,  0,
+	 11,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  4,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  1,  0,  0,  0,  0,  0,
+	  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  7,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  2,  0,  1,  0,  0,  0,  0,  0,  4,  0,  1,  0,  0,  0,  0,  0,
+	 10,  0,  1,  0,  0,  0,  0,  0, 12,  0,  1,  0,  0,  0,  0,  0,
+	  4,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  8,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	  3,  0,  1,  0,  0,  0,  0,  0,  3,  0,  1,  0,  0,  0,  0,  0,
+	  4,  0,  1,  0,  0,  0,  0,  0,  1,  2, 36,  1,  2,  3,  4, 36,
+	  1, 36,  5,  6,  7,  8, 36,  9, 10, 11, 12,  1, 36, 13, 14, 15,
+	 36, 16, 17, 36, 36, 36, 17, 36, 17, 36, 18, 36,  1, 36,  1, 36,
+	 36,  1, 36, 36, 36, 36,  1, 36, 36, 36, 36, 36, 36,  1,  1, 19,
+	  1,  1, 36, 36, 36, 36, 36, 36,  1, 36, 36, 36,  1, 36,  1, 36,
+	 36, 36,  1, 36, 36,  2, 36, 36,  2, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 20, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	  4,  4,  4,  4,  4,  4, 21,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+	  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4, 22,  4,  4,  4,
+	  4,  4,  4,  4,  4, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 23, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,  6,  6,  6,  6,
+	  6,  6,  6,  6,  6,  6,  6, 21,  6,  6,  6,  6,  6,  6,  6,  6,
+	  6,  6,  6,  6,  6,  6,  6,  6, 24,  6,  6,  6,  6,  6,  6,  6,
+	  6, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,  1, 36,
+	 36,  1, 36, 36, 36, 36,  1, 36, 36, 36, 36, 36, 36,  1, 10, 19,
+	 12,  1, 36, 36, 36, 36, 36, 36,  1, 36, 36, 36,  1, 36,  1, 36,
+	 36, 36,  1, 36,  1, 36, 36,  1, 36, 36, 36, 36,  1, 36, 36, 36,
+	 36, 36, 36,  1,  1, 19, 25,  1, 36, 36, 36, 36, 36, 36,  1, 36,
+	 36, 36,  1, 36,  1, 36, 36, 36,  1, 36,  1, 36, 36,  1, 36, 36,
+	 36, 36,  1, 36, 36, 36, 36, 36, 36,  1,  1, 26,  1,  1, 36, 36,
+	 36, 36, 36, 16, 17, 36, 36, 36, 17, 36, 17, 36, 36, 36,  1, 36,
+	  1, 36, 36,  1, 36, 36, 36, 36,  1, 36, 36, 36, 36, 36, 36,  1,
+	 10, 19, 12,  1, 36, 36, 36, 36, 36, 36,  1, 36, 36, 36,  1, 36,
+	  1, 36, 36, 36,  1, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 27, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 28, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 29, 36, 36, 29, 36, 36, 36, 36,
+	 29, 36, 36, 36, 36, 36, 36, 29, 29, 36, 29, 29, 36, 36, 36, 36,
+	 36, 36, 29, 36, 36, 36, 29, 36, 29, 36, 36, 36, 29, 36,  1, 36,
+	 36,  1, 36, 36, 36, 36,  1, 36, 36, 36, 30, 36, 36,  1,  1, 19,
+	 17,  1, 36, 36, 36, 36, 36, 36, 17, 36, 36, 36, 17, 36, 17, 36,
+	 36, 36,  1, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 31, 36, 36, 36,  1, 36, 36,  1, 36, 36,
+	 36, 36,  1, 36, 36, 36, 36, 36, 36,  1,  1, 32,  1,  1, 36, 36,
+	 36, 36, 36, 16, 17, 36, 36, 36, 17, 36, 17, 36, 36, 36,  1, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,  4,  4,  4,  4,
+	  4,  4, 33,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+	  4,  4,  4,  4,  4,  4,  4,  4, 22,  4,  4,  4,  4,  4,  4,  4,
+	  4, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36,  6,  6,  6,  6,  6,  6,  6,  6,
+	  6,  6,  6, 34,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+	  6,  6,  6,  6, 24,  6,  6,  6,  6,  6,  6,  6,  6, 36,  1, 36,
+	 36,  1, 36, 36, 36, 36,  1, 36, 36, 36, 36, 36, 36,  1,  1, 19,
+	 25,  1, 36, 36, 36, 36, 36, 36,  1, 36, 36, 36,  1, 36,  1, 36,
+	 36, 36,  1, 36,  1, 36, 36,  1, 36, 36, 36, 36,  1, 36, 36, 36,
+	 36, 36, 36,  1,  1, 36,  1,  1, 36, 36, 36, 36, 36, 16, 17, 36,
+	 36, 36, 17, 36, 17, 36, 36, 36,  1, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 29, 36, 36, 29, 36, 36, 36, 36, 29, 36,
+	 36, 36, 36, 36, 36, 29, 29, 36, 29, 29, 36, 36, 36, 36, 36, 36,
+	 29, 36, 36, 36, 29, 36, 29, 36, 36, 36, 29, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 35, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36,  1, 36, 36,  1, 36, 36, 36, 36,
+	  1, 36, 36, 36, 36, 36, 36,  1,  1, 36,  1,  1, 36, 36, 36, 36,
+	 36, 16, 17, 36, 36, 36, 17, 36, 17, 36, 36, 36,  1, 36,  4,  4,
+	  4,  4,  4,  4, 21,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+	  4,  4,  4,  4,  4,  4,  4,  4,  4,  4, 22,  4,  4,  4,  4,  4,
+	  4,  4,  4, 36,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6, 21,
+	  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+	 24,  6,  6,  6,  6,  6,  6,  6,  6, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	  0,  0,  5,  0,176, 13,  0,  0,  0,  0,  7,  0,200, 13,  0,  0,
+	  0,  0,  5,  0,232, 13,  0,  0,  0,  0,  6,  0,  0, 14,  0,  0,
+	  0,  0,  4,  0, 28, 14,  0,  0,  0,  0,  2,  0, 48, 14,  0,  0,
+	  0,  0,  2,  0, 60, 14,  0,  0,  0,  0,  3,  0, 72, 14,  0,  0,
+	  0,  0,  2,  0, 88, 14,  0,  0,  0,  0,  2,  0,100, 14,  0,  0,
+	  0,  0,  2,  0,112, 14,  0,  0,  0,  0,  2,  0,124, 14,  0,  0,
+	  0,  0,  2,  0,136, 14,  0,  0,  0,  0,  2,  0,148, 14,  0,  0,
+	  0,  0,  3,  0,160, 14,  0,  0,  0,  1,  5,  0,176, 14,  0,  0,
+	101,  0,  0,  0,114,  0,  0,  0,114,  0,  0,  0,111,  0,  0,  0,
+	114,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0,110,  0,  0,  0,
+	116,  0,  0,  0,101,  0,  0,  0,103,  0,  0,  0,101,  0,  0,  0,
+	114,  0,  0,  0,  0,  0,  0,  0,102,  0,  0,  0,108,  0,  0,  0,
+	111,  0,  0,  0, 97,  0,  0,  0,116,  0,  0,  0,  0,  0,  0,  0,
+	115,  0,  0,  0,116,  0,  0,  0,114,  0,  0,  0,105,  0,  0,  0,
+	110,  0,  0,  0,103,  0,  0,  0,  0,  0,  0,  0,112,  0,  0,  0,
+	 97,  0,  0,  0,116,  0,  0,  0,104,  0,  0,  0,  0,  0,  0,  0,
+	108,  0,  0,  0,112,  0,  0,  0,  0,  0,  0,  0,114,  0,  0,  0,
+	112,  0,  0,  0,  0,  0,  0,  0, 97,  0,  0,  0,110,  0,  0,  0,
+	100,  0,  0,  0,  0,  0,  0,  0,111,  0,  0,  0,114,  0,  0,  0,
+	  0,  0,  0,  0,108,  0,  0,  0,115,  0,  0,  0,  0,  0,  0,  0,
+	108,  0,  0,  0,113,  0,  0,  0,  0,  0,  0,  0,109,  0,  0,  0,
+	101,  0,  0,  0,  0,  0,  0,  0,109,  0,  0,  0,113,  0,  0,  0,
+	  0,  0,  0,  0,101,  0,  0,  0,113,  0,  0,  0,  0,  0,  0,  0,
+	110,  0,  0,  0,101,  0,  0,  0,113,  0,  0,  0,  0,  0,  0,  0,
+	115,  0,  0,  0,112,  0,  0,  0, 97,  0,  0,  0, 99,  0,  0,  0,
+	101,  0,  0,  0,  0,  0,  0,  0
 };
-extern const unsigned int predicate_bc_length = 150224;
+extern const unsigned int predicate_bc_length = 3784;
@@ -30,6 +30,8 @@
 
 extern const unsigned char sax_bc[];
 extern const unsigned int sax_bc_length;
+extern const unsigned char string_bc[];
+extern const unsigned int string_bc_length;
 
 namespace tlib
 {
@@ -208,6 +210,38 @@ extern const unsigned char encoding_bc[];
 extern const unsigned int encoding_bc_length;
 
 
+/* The lexers are loaded once and shared by all of the parsers. */
+static const lex::CompiledLexer<char>::CompiledLexerPtr& sax_lexer()
+{
+	static const lex::CompiledLexer<char>::CompiledLexerPtr lexer =
+			lex::CompiledLexer<char>::create_by_static_bc(::sax_bc, ::sax_bc_length);
+	return lexer;
+}
+
+static const lex::CompiledLexer<char>::CompiledLexerPtr& node_entry_lexer()
+{
+	static const lex::CompiledLexer<char>::CompiledLexerPtr lexer =
+			lex::CompiledLexer<char>::create_by_static_bc(
+					::node_entry_bc, ::node_entry_bc_length);
+	return lexer;
+}
+
+static const lex::CompiledLexer<char>::CompiledLexerPtr& encoding_lexer()
+{
+	static const lex::CompiledLexer<char>::CompiledLexerPtr lexer =
+			lex::CompiledLexer<char>::create_by_static_bc(
+					::encoding_bc, ::encoding_bc_length);
+	return lexer;
+}
+
+static const lex::CompiledLexer<char>::CompiledLexerPtr& string_lexer()
+{
+	static const lex::CompiledLexer<char>::CompiledLexerPtr lexer =
+			lex::CompiledLexer<char>::create_by_static_bc(
+					::string_bc, ::string_bc_length);
+	return lexer;
+}
+
 // Format string in attribute
 static void attr_repl(std::string& src)
 {
@@ -230,7 +264,7 @@ static void attr_repl(std::string& src)
 static void parse_attribute(const char* src, size_t len,
 		const std::string& charset, std::wstring& attr)
 {
-	lex::Regex<char> attr_regex(node_entry_bc, node_entry_bc_length, true);
+	lex::Regex<char> attr_regex(node_entry_lexer());
 	std::string result = lex::regex_replace<char>(
 			std::string(src + 1, len - 2), attr_regex, attr_repl);
 	charset_to_wstring(result, charset, attr);
@@ -250,13 +284,12 @@ bool SaxParser::parse(std::istream& ins,
 	std::wstring text;
 	try
 	{
-		lex::Lexical<char>::LexicalPtr lex =
-				lex::Lexical<char>::create_by_static_bc(::sax_bc, ::sax_bc_length);
-		lex->parse(ins);
-		lex->best_match = true;
+		lex::Scanner<char> lex(sax_lexer());
+		lex.parse(ins);
+		lex.best_match = true;
 		FIRE(on_start_document());
 		lex::Token<char> token;
-		while (lex->fetch_next(token))
+		while (lex.fetch_next(token))
 		{
 			if (token.action == 0)
 			{
@@ -273,13 +306,12 @@ bool SaxParser::parse(std::istream& ins,
 					// parse xml version and encoding
 					std::string xml_pi = token.str.substr(5, token.length - 7);
 					std::string encoding;
-					lex::Regex<char> encoding_regex(
-							encoding_bc, encoding_bc_length, true);
+					lex::Regex<char> encoding_regex(encoding_lexer());
 					size_t fnd = lex::regex_find<char>(
 							xml_pi, encoding_regex, encoding);
 					if (fnd != xml_pi.npos)
 					{
-						lex::Regex<char> string_regex("\"[^\"]*\"|'[^']*'");
+						lex::Regex<char> string_regex(string_lexer());
 						lex::regex_find<char>(encoding, string_regex, encoding);
 						encoding = encoding.substr(1, encoding.length() - 2);
 						unsigned int cp = convert_charset_to_codepage(encoding.c_str());
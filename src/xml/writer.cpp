@@ -26,11 +26,32 @@
 #include "../tlibdata.h"
 #include "writer.h"
 
+extern const unsigned char value_format_bc[];
+extern const unsigned int value_format_bc_length;
+extern const unsigned char text_format_bc[];
+extern const unsigned int text_format_bc_length;
+
 namespace tlib
 {
 namespace xml
 {
 
+/* The lexers of the format regexes are loaded once. */
+static const lex::CompiledLexer<char>::CompiledLexerPtr& value_format_lexer()
+{
+	static const lex::CompiledLexer<char>::CompiledLexerPtr lexer =
+			lex::CompiledLexer<char>::create_by_static_bc(
+					::value_format_bc, ::value_format_bc_length);
+	return lexer;
+}
+
+static const lex::CompiledLexer<char>::CompiledLexerPtr& text_format_lexer()
+{
+	static const lex::CompiledLexer<char>::CompiledLexerPtr lexer =
+			lex::CompiledLexer<char>::create_by_static_bc(
+					::text_format_bc, ::text_format_bc_length);
+	return lexer;
+}
 
 XmlWriter::XmlWriter(std::ostream& out, const std::string& charset, bool format)
 : _out(out), _charset(charset), _charset_ext(charset),
@@ -135,7 +156,7 @@ void XmlWriter::write_element(const std::wstring& name, const xml::SaxAttributes
 		_out << NEW_LINE;
 	}
 	IDOUT << "<" << CVT(name);
-	lex::Regex<char> value_format_regex("&|\"");
+	lex::Regex<char> value_format_regex(value_format_lexer());
 	for (size_t i = 0; i < attributes.size(); i++)
 	{
 		std::string value =
@@ -159,7 +180,7 @@ void XmlWriter::write_start_element(const std::wstring& name, const xml::SaxAttr
 		_out << NEW_LINE;
 	}
 	IDOUT << "<" << CVT(name);
-	lex::Regex<char> value_format_regex("&|\"");
+	lex::Regex<char> value_format_regex(value_format_lexer());
 	for (size_t i = 0; i < attributes.size(); i++)
 	{
 		std::string value =
@@ -188,7 +209,7 @@ void XmlWriter::write_text(const std::wstring& text)
 {
 	if (_level.empty())
 		return;
-	lex::Regex<char> text_format_regex("&|<|>");
+	lex::Regex<char> text_format_regex(text_format_lexer());
 	std::string value = lex::regex_replace<char>(CVT(text),
 			text_format_regex, text_format_repl);
 	_text += value;
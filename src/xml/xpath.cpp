@@ -32,6 +32,9 @@ extern const unsigned int path_bc_length;
 extern const unsigned char predicate_bc[];
 extern const unsigned int predicate_bc_length;
 
+// Tokens fetched from the lexical at once.
+#define XPATH_TOKEN_BATCH 64
+
 namespace tlib
 {
 namespace xml
@@ -40,6 +43,22 @@ namespace xpath
 {
 
 
+/* The lexers are loaded once and shared by all of the xpaths. */
+static const lex::CompiledLexer<wchar_t>::CompiledLexerPtr& path_lexer()
+{
+	static const lex::CompiledLexer<wchar_t>::CompiledLexerPtr lexer =
+			lex::CompiledLexer<wchar_t>::create_by_static_bc(path_bc, path_bc_length);
+	return lexer;
+}
+
+static const lex::CompiledLexer<wchar_t>::CompiledLexerPtr& predicate_lexer()
+{
+	static const lex::CompiledLexer<wchar_t>::CompiledLexerPtr lexer =
+			lex::CompiledLexer<wchar_t>::create_by_static_bc(
+					predicate_bc, predicate_bc_length);
+	return lexer;
+}
+
 #define THROW(x) throw std::runtime_error(x)
 static const char* _err_unexpected_token = "Invalid xpath syntax: Unexpected token.";
 static const char* _err_unexpected_end = "Invalid xpath syntax: Unexpected end.";
@@ -53,10 +72,8 @@ _Predicate::~_Predicate()
 XPath::XPath(const std::wstring& xpath) throw (std::runtime_error)
 {
 	// This function has been finished.
-	lex::Lexical<wchar_t>::LexicalPtr lex =
-			lex::Lexical<wchar_t>::create_by_static_bc(path_bc, path_bc_length);
-	std::wistringstream iss(xpath);
-	lex->parse(iss);
+	lex::Scanner<wchar_t> lex(path_lexer());
+	lex.parse(xpath.c_str(), xpath.length());
 	enum
 	{
 		T_ELEMENT = 1,
@@ -78,62 +95,100 @@ XPath::XPath(const std::wstring& xpath) throw (std::runtime_error)
 		S_PREDICATE,
 		S_END_PREDICATE
 	};
-	lex::Token<wchar_t> token;
 	int state = S_BEGIN;
 	Path path;
 	Step step;
-	while (lex->fetch_next(token))
+	lex::TokenBatch batch;
+	while (lex.next_tokens(batch, XPATH_TOKEN_BATCH))
 	{
-		if (state == S_BEGIN)
-		{
-			if (token.action == T_ELEMENT
-					|| token.action == T_SELF
-					|| token.action == T_PARENT)
-			{
-				step.axis = Step::AXIS_CURRENT;
-				step.name = token.str;
-				state = S_NODE;
-			}
-			else if (token.action == T_FUNCTION
-					|| token.action == T_ATTRIBUTE)
-			{
-				step.axis = Step::AXIS_CURRENT;
-				step.name = token.str;
-				state = S_END_NODE;
-			}
-			else if (token.action == T_SPLIT)
-			{
-				step.axis = Step::AXIS_DIRECT;
-				state = S_SPLIT;
-			}
-			else if (token.action == T_SPLIT2)
-			{
-				step.axis = Step::AXIS_INDIRECT;
-				state = S_SPLIT;
-			}
-			else
-			{
-				THROW(_err_unexpected_token);
-			}
-		}
-		else if (state == S_SPLIT)
+		for (size_t i = 0; i < batch.size(); i++)
 		{
-			if (token.action == T_ELEMENT
-					|| token.action == T_SELF
-					|| token.action == T_PARENT)
+			lex::Action action = batch.action[i];
+			if (state == S_BEGIN)
 			{
-				step.name = token.str;
-				state = S_NODE;
+				if (action == T_ELEMENT
+						|| action == T_SELF
+						|| action == T_PARENT)
+				{
+					step.axis = Step::AXIS_CURRENT;
+					step.name = xpath.substr(batch.pos[i], batch.length[i]);
+					state = S_NODE;
+				}
+				else if (action == T_FUNCTION
+						|| action == T_ATTRIBUTE)
+				{
+					step.axis = Step::AXIS_CURRENT;
+					step.name = xpath.substr(batch.pos[i], batch.length[i]);
+					state = S_END_NODE;
+				}
+				else if (action == T_SPLIT)
+				{
+					step.axis = Step::AXIS_DIRECT;
+					state = S_SPLIT;
+				}
+				else if (action == T_SPLIT2)
+				{
+					step.axis = Step::AXIS_INDIRECT;
+					state = S_SPLIT;
+				}
+				else
+				{
+					THROW(_err_unexpected_token);
+				}
 			}
-			else if (token.action == T_FUNCTION
-					|| token.action == T_ATTRIBUTE)
+			else if (state == S_SPLIT)
 			{
-				step.name = token.str;
-				state = S_END_NODE;
+				if (action == T_ELEMENT
+						|| action == T_SELF
+						|| action == T_PARENT)
+				{
+					step.name = xpath.substr(batch.pos[i], batch.length[i]);
+					state = S_NODE;
+				}
+				else if (action == T_FUNCTION
+						|| action == T_ATTRIBUTE)
+				{
+					step.name = xpath.substr(batch.pos[i], batch.length[i]);
+					state = S_END_NODE;
+				}
+				else if (action == T_OR)
+				{
+					if (path.empty())
+					{
+						path.push_back(step);
+						paths.push_back(path);
+						path.clear();
+						step.reset();
+						state = S_BEGIN;
+					}
+					else
+						THROW(_err_unexpected_token);
+				}
+				else
+					THROW(_err_unexpected_token);
 			}
-			else if (token.action == T_OR)
+			else if (state == S_NODE)
 			{
-				if (path.empty())
+				if (action == T_PREDICATE)
+				{
+					step.predicate = Predicate::create(xpath.substr(batch.pos[i], batch.length[i]));
+					state = S_PREDICATE;
+				}
+				else if (action == T_SPLIT)
+				{
+					path.push_back(step);
+					step.reset();
+					step.axis = Step::AXIS_DIRECT;
+					state = S_SPLIT;
+				}
+				else if (action == T_SPLIT2)
+				{
+					path.push_back(step);
+					step.reset();
+					step.axis = Step::AXIS_INDIRECT;
+					state = S_SPLIT;
+				}
+				else if (action == T_OR)
 				{
 					path.push_back(step);
 					paths.push_back(path);
@@ -142,107 +197,73 @@ XPath::XPath(const std::wstring& xpath) throw (std::runtime_error)
 					state = S_BEGIN;
 				}
 				else
+				{
 					THROW(_err_unexpected_token);
+				}
 			}
-			else
-				THROW(_err_unexpected_token);
-		}
-		else if (state == S_NODE)
-		{
-			if (token.action == T_PREDICATE)
-			{
-				step.predicate = Predicate::create(token.str);
-				state = S_PREDICATE;
-			}
-			else if (token.action == T_SPLIT)
-			{
-				path.push_back(step);
-				step.reset();
-				step.axis = Step::AXIS_DIRECT;
-				state = S_SPLIT;
-			}
-			else if (token.action == T_SPLIT2)
-			{
-				path.push_back(step);
-				step.reset();
-				step.axis = Step::AXIS_INDIRECT;
-				state = S_SPLIT;
-			}
-			else if (token.action == T_OR)
-			{
-				path.push_back(step);
-				paths.push_back(path);
-				path.clear();
-				step.reset();
-				state = S_BEGIN;
-			}
-			else
-			{
-				THROW(_err_unexpected_token);
-			}
-		}
-		else if (state == S_END_NODE)
-		{
-			if (token.action == T_PREDICATE)
-			{
-				step.predicate = Predicate::create(token.str);
-				state = S_END_PREDICATE;
-			}
-			else if (token.action == T_OR)
-			{
-				path.push_back(step);
-				paths.push_back(path);
-				path.clear();
-				step.reset();
-				state = S_BEGIN;
-			}
-			else
-			{
-				THROW(_err_unexpected_token);
-			}
-		}
-		else if (state == S_PREDICATE)
-		{
-			if (token.action == T_SPLIT)
-			{
-				path.push_back(step);
-				step.reset();
-				step.axis = Step::AXIS_DIRECT;
-				state = S_SPLIT;
-			}
-			else if (token.action == T_SPLIT2)
-			{
-				path.push_back(step);
-				step.reset();
-				step.axis = Step::AXIS_INDIRECT;
-				state = S_SPLIT;
-			}
-			else if (token.action == T_OR)
+			else if (state == S_END_NODE)
 			{
-				path.push_back(step);
-				paths.push_back(path);
-				path.clear();
-				step.reset();
-				state = S_BEGIN;
+				if (action == T_PREDICATE)
+				{
+					step.predicate = Predicate::create(xpath.substr(batch.pos[i], batch.length[i]));
+					state = S_END_PREDICATE;
+				}
+				else if (action == T_OR)
+				{
+					path.push_back(step);
+					paths.push_back(path);
+					path.clear();
+					step.reset();
+					state = S_BEGIN;
+				}
+				else
+				{
+					THROW(_err_unexpected_token);
+				}
 			}
-			else
+			else if (state == S_PREDICATE)
 			{
-				THROW(_err_unexpected_token);
-			}
-		}
-		else if (state == S_END_PREDICATE)
-		{
-			if (token.action == T_OR)
-			{
-				path.push_back(step);
-				paths.push_back(path);
-				path.clear();
-				step.reset();
-				state = S_BEGIN;
+				if (action == T_SPLIT)
+				{
+					path.push_back(step);
+					step.reset();
+					step.axis = Step::AXIS_DIRECT;
+					state = S_SPLIT;
+				}
+				else if (action == T_SPLIT2)
+				{
+					path.push_back(step);
+					step.reset();
+					step.axis = Step::AXIS_INDIRECT;
+					state = S_SPLIT;
+				}
+				else if (action == T_OR)
+				{
+					path.push_back(step);
+					paths.push_back(path);
+					path.clear();
+					step.reset();
+					state = S_BEGIN;
+				}
+				else
+				{
+					THROW(_err_unexpected_token);
+				}
 			}
-			else
+			else if (state == S_END_PREDICATE)
 			{
-				THROW(_err_unexpected_token);
+				if (action == T_OR)
+				{
+					path.push_back(step);
+					paths.push_back(path);
+					path.clear();
+					step.reset();
+					state = S_BEGIN;
+				}
+				else
+				{
+					THROW(_err_unexpected_token);
+				}
 			}
 		}
 	}
@@ -311,10 +332,9 @@ PredicatePtr _Predicate::create(const std::wstring& predicate)
 	/*| log |*/ { '>','?','<','>','>','>','>' }
 	};
 
-	lex::Lexical<wchar_t>::LexicalPtr lex =
-			lex::Lexical<wchar_t>::create_by_static_bc(predicate_bc, predicate_bc_length);
+	lex::Scanner<wchar_t> lex(predicate_lexer());
 	std::wistringstream iss(predicate.substr(1, predicate.size() - 2));
-	lex->parse(iss);
+	lex.parse(iss);
 	std::stack<unsigned int> op_stack;
 	std::stack<PredicatePtr> exp_stack;
 	lex::Token<wchar_t> token;
@@ -322,7 +342,7 @@ PredicatePtr _Predicate::create(const std::wstring& predicate)
 	bool is_eof = false;
 	while (!is_eof)
 	{
-		lex->next_token(token);
+		lex.next_token(token);
 		if (token.action == 0 && token.length == 0)
 			is_eof = true;
 		if (token.action >= TK_INTEGER
@@ -7,6 +7,7 @@
 
 
 #include "../include/tlib/tlib.h"
+#include "../include/tlib/lex/regex.h"
 #include <iostream>
 
 using namespace std;
@@ -139,6 +140,133 @@ void test_encode() {
 
 }
 
+// Text of the regex and lexical tests.
+string lex_text() {
+	string s;
+	for (int i = 0; i < 200; i++) {
+		s += "item" + to_string(i) + " = 0x" + to_string(i * 37 % 256) + "; ";
+		s += (i % 3 == 0) ? "// abc def\n" : "\tx+y*z;\n";
+	}
+	return s;
+}
+
+void test_regex_find_replace() {
+	string s = "ab12cd345ef6";
+	lex::Regex<char> regex("[0-9]+");
+	string fnd;
+	size_t pos = lex::regex_find(s, regex, fnd);
+	cout << pos << ":" << fnd << endl;
+	pos = lex::regex_find(s, regex, fnd, pos + fnd.length());
+	cout << pos << ":" << fnd << endl;
+	pos = lex::regex_find(s, regex, fnd, 8);
+	cout << pos << ":" << fnd << endl;
+	pos = lex::regex_find(s, regex, fnd, 12);
+	cout << (pos == s.npos ? "npos" : "found") << endl;
+
+	cout << lex::regex_replace(s, regex, string("#")) << endl;
+	cout << lex::regex_replace(s, regex, string("#"), 2) << endl;
+	cout << lex::regex_replace(s, regex, string("#"), 0) << endl;
+}
+
+void test_regex_iterator() {
+	string s = lex_text();
+	lex::Regex<char> regex("0x[0-9]+|[a-z]+[0-9]+");
+	vector<pair<size_t, size_t> > found;
+	string fnd;
+	size_t pos = lex::regex_find(s, regex, fnd);
+	while (pos != s.npos) {
+		found.push_back(make_pair(pos, fnd.length()));
+		pos = lex::regex_find(s, regex, fnd, pos + (fnd.empty() ? 1 : fnd.length()));
+	}
+	vector<pair<size_t, size_t> > iterated;
+	for (lex::RegexIterator<char> it(s, regex), end; it != end; ++it)
+		iterated.push_back(make_pair(it->pos, it->length));
+	cout << "regex iterator: " << iterated.size() << " matches, "
+			<< (iterated == found ? "same as regex_find" : "different") << endl;
+}
+
+void test_regex_set() {
+	vector<string> patterns;
+	patterns.push_back("0x[0-9]+");
+	patterns.push_back("//[^\\n]*");
+	patterns.push_back("[a-z]+[0-9]+");
+	patterns.push_back("@@");
+	patterns.push_back("x\\+y");
+	lex::RegexSet<char> set(patterns);
+	vector<string> inputs;
+	inputs.push_back(lex_text());
+	inputs.push_back("a = 0x12;");
+	inputs.push_back("nothing here");
+	inputs.push_back("");
+	for (size_t i = 0; i < inputs.size(); i++) {
+		vector<unsigned int> ids, expected;
+		set.match(inputs[i], ids);
+		for (unsigned int id = 0; id < patterns.size(); id++) {
+			lex::Regex<char> regex(patterns[id]);
+			if (lex::regex_find(inputs[i], regex) != inputs[i].npos)
+				expected.push_back(id);
+		}
+		cout << "regex set:";
+		for (size_t j = 0; j < ids.size(); j++)
+			cout << " " << ids[j];
+		cout << (ids == expected ? ", same as regex_find" : ", different") << endl;
+	}
+}
+
+const char* lex_definition =
+	"#! sp: [ \\t\\r\\n]+\n"
+	"id: [a-zA-Z_][a-zA-Z0-9_]*\n"
+	"number: 0x[0-9a-fA-F]+|[0-9]+\n"
+	"comment: //[^\\n]*\n"
+	"operator: =|;|\\+|\\*\n"
+	"space(i): {sp}\n";
+
+void fetch_all(lex::Lexical<char>& lexical, const string& s, lex::TokenBatch& batch) {
+	lexical.parse(s.c_str(), s.length());
+	batch.clear();
+	lex::TokenBatch part;
+	while (lexical.next_tokens(part, 64) > 0) {
+		batch.action.insert(batch.action.end(), part.action.begin(), part.action.end());
+		batch.pos.insert(batch.pos.end(), part.pos.begin(), part.pos.end());
+		batch.length.insert(batch.length.end(), part.length.begin(), part.length.end());
+		batch.line.insert(batch.line.end(), part.line.begin(), part.line.end());
+		batch.line_pos.insert(batch.line_pos.end(), part.line_pos.begin(), part.line_pos.end());
+	}
+}
+
+bool same_tokens(const lex::TokenBatch& a, const lex::TokenBatch& b) {
+	return a.action == b.action && a.pos == b.pos && a.length == b.length
+			&& a.line == b.line && a.line_pos == b.line_pos;
+}
+
+void test_lexical_lazy() {
+	string s = lex_text();
+	auto full = lex::Lexical<char>::create(lex_definition);
+	// A tiny cache is dropped and built again many times while scanning.
+	auto lazy = lex::Lexical<char>::create_lazy(lex_definition, 1024);
+	lex::TokenBatch a, b;
+	fetch_all(*full, s, a);
+	fetch_all(*lazy, s, b);
+	cout << "lazy lexical: " << a.size() << " tokens, "
+			<< (same_tokens(a, b) ? "same as full" : "different") << endl;
+}
+
+void test_lexical_tokenize() {
+	// Big enough to be split into chunks.
+	string s;
+	for (int i = 0; i < 64; i++)
+		s += lex_text();
+	auto lexical = lex::Lexical<char>::create(lex_definition);
+	lex::TokenBatch expected;
+	fetch_all(*lexical, s, expected);
+	for (unsigned int threads = 1; threads <= 8; threads *= 2) {
+		lex::TokenBatch batch;
+		lexical->tokenize(s.c_str(), s.length(), batch, threads);
+		cout << "tokenize by " << threads << " threads: " << batch.size() << " tokens, "
+				<< (same_tokens(batch, expected) ? "same as next_tokens" : "different") << endl;
+	}
+}
+
 int main(int argc, char* argv[]) {
 	init_locale();
 
@@ -153,6 +281,11 @@ int main(int argc, char* argv[]) {
 	test_os_functionS();
 	test_binary();
 	test_encode();
+	test_regex_find_replace();
+	test_regex_iterator();
+	test_regex_set();
+	test_lexical_lazy();
+	test_lexical_tokenize();
 
 	return 0;
 }
@@ -0,0 +1,699 @@
+/************************************************************************
+*
+*  LibTLib
+*  Copyright (C) 2010  Thor Qin
+*
+* This library is free software; you can redistribute it and/or
+* modify it under the terms of the GNU Lesser General Public
+* License as published by the Free Software Foundation; either
+* version 2 of the License, or (at your option) any later version.
+*
+* This library is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+* Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License along with this library; if not, write to the Free Software
+* Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA
+*
+* Author: Thor Qin
+* Bug Report: thor.qin@gmail.com
+*
+**************************************************************************/
+
+
+
+/* This file is a tool to measure the speed of the lexical and the regular
+ * expression functions, the result can be written as JSON to compare the
+ * speed between releases. */
+
+#include "../../include/tlib/tlib.h"
+#include "../../include/tlib/lex/lex.h"
+#include "../../include/tlib/lex/regex.h"
+#include <locale.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#ifdef __MSVC__
+#pragma warning(disable : 4996)
+#include <windows.h>
+#elif defined(__GNUC__)
+#include <time.h>
+#endif
+
+using namespace std;
+using namespace tlib;
+
+/* Generated by "lexgen --cpp --name sax" from the SAX lexical. */
+extern const bool sax_ignore[];
+unsigned int sax_scan(const char* p, const char* end,
+		bool best_match, unsigned int* length);
+
+
+void show_error()
+{
+	fprintf(stderr, "Invalid parameters. \n"
+			"Please try \"lexbench --help\""
+			" to get more informations.\n\n");
+}
+
+void show_usage()
+{
+	printf("Usage: lexbench [options]\n" \
+			"  Measure the speed of the lexical and the regular expression.\n");
+	printf("Options:\n" \
+			"  -s, --size <KB>    Size of every generated corpus, default is 4096.\n"
+			"  -r, --repeat <N>   Run every case N times and take the fastest,\n"
+			"                     default is 3.\n"
+			"  -c, --corpus <LEX> <INPUT>\n"
+			"                     Also measure the lexical file LEX on the text\n"
+			"                     file INPUT, can be given many times.\n"
+			"  -x, --sax <LEX>    Also measure the SAX lexical LEX on the generated\n"
+			"                     XML, with the table scanner and the scanner\n"
+			"                     generated by \"lexgen --cpp\", LEX must be the\n"
+			"                     file the generated scanner was made of.\n"
+			"  -g, --grammar <LEX>\n"
+			"                     Only measure the compile time of the lexical\n"
+			"                     file LEX, can be given many times.\n"
+			"  -j, --json         Output the result as JSON.\n"
+			"  -o, --out <NAME>   Output file, default output is the console.\n"
+			"  -h, --help         Show this usage information and leave.\n\n");
+}
+
+
+/* Generated corpora */
+
+static const char* c_lexical =
+	"#! sp: [ \\t\\r\\n]+\n"
+	"key: if|else|for|while|return|int|char|void|static|const|struct\n"
+	"id: [a-zA-Z_][a-zA-Z0-9_]*\n"
+	"number: 0x[0-9a-fA-F]+|[0-9]+\n"
+	"string: \"([^\\\"\\n]|\\\\\")*\"\n"
+	"comment(m): /\\*.*\\*/\n"
+	"comment: //[^\\n]*\n"
+	"operator: \\(|\\)|{|}|\\[|\\]|<|>|!|\\.|,|;|\\+|-|\\*|/|=|==|!=|<=|>=|&&|\\|\\|\n"
+	"space(i): {sp}\n";
+
+static const char* xml_lexical =
+	"#! sp: [ \\r\\n\\t]+\n"
+	"#! name: [a-zA-Z_][a-zA-Z0-9_\\-\\.:]*\n"
+	"pi(m): <\\?.*\\?>\n"
+	"start: <{name}\n"
+	"close: </{name}>\n"
+	"end: >|/>\n"
+	"equal: =\n"
+	"name: {name}\n"
+	"value: \"[^\"]*\"|'[^']*'\n"
+	"text: [^<>\"'= \\r\\n\\t]+\n"
+	"comment(m): <!--.*-->\n"
+	"space(i): {sp}\n";
+
+static const char* log_lexical =
+	"date: [0-9][0-9][0-9][0-9]-[0-9][0-9]-[0-9][0-9]\n"
+	"time: [0-9][0-9]:[0-9][0-9]:[0-9][0-9]\\.[0-9]+\n"
+	"level: \\[(DEBUG|INFO|WARN|ERROR)\\]\n"
+	"word: [a-zA-Z_][a-zA-Z0-9_\\.]*\n"
+	"number: [0-9]+\n"
+	"punct: [=:,;\\(\\)/\\-]\n"
+	"space(i): [ \\t]+\n"
+	"eol: \\n\n";
+
+static unsigned int random_seed = 1;
+
+unsigned int next_random(unsigned int range)
+{
+	random_seed = random_seed * 1103515245 + 12345;
+	return (random_seed >> 16) % range;
+}
+
+const char* random_word()
+{
+	static const char* words[] = {
+		"buffer", "length", "index", "count", "state", "token", "value",
+		"result", "input", "output", "node", "table", "offset", "data" };
+	return words[next_random(sizeof(words) / sizeof(words[0]))];
+}
+
+string generate_c(size_t size)
+{
+	ostringstream out;
+	unsigned int n = 0;
+	while ((size_t)out.tellp() < size)
+	{
+		out << "/* Function " << n << " of the generated source. */\n"
+			<< "static int " << random_word() << "_" << n
+			<< "(const char* " << random_word() << ", int len)\n{\n";
+		for (unsigned int i = next_random(8) + 2; i > 0; i--)
+		{
+			switch (next_random(4))
+			{
+			case 0:
+				out << "\tfor (int i = 0; i < len; i++)\n\t\t" << random_word()
+					<< "[i] = 0x" << hex << next_random(65536) << dec << ";\n";
+				break;
+			case 1:
+				out << "\tif (" << random_word() << " != " << next_random(1000)
+					<< ")\n\t\treturn " << random_word() << " + 1;\n";
+				break;
+			case 2:
+				out << "\tprintf(\"" << random_word() << " is %d\\n\", "
+					<< random_word() << ");\n";
+				break;
+			default:
+				out << "\t// " << random_word() << " " << random_word() << "\n\t"
+					<< random_word() << " = " << random_word() << " * "
+					<< next_random(100) << ";\n";
+			}
+		}
+		out << "\treturn 0;\n}\n\n";
+		n++;
+	}
+	return out.str();
+}
+
+string generate_xml(size_t size)
+{
+	ostringstream out;
+	out << "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<root>\n";
+	unsigned int n = 0;
+	while ((size_t)out.tellp() < size)
+	{
+		out << "\t<!-- item " << n << " -->\n"
+			<< "\t<item id=\"" << n << "\" name='" << random_word() << "'>\n";
+		for (unsigned int i = next_random(4) + 1; i > 0; i--)
+		{
+			const char* tag = random_word();
+			out << "\t\t<" << tag << " size=\"" << next_random(10000) << "\">"
+				<< random_word() << " " << random_word() << "</" << tag << ">\n";
+		}
+		out << "\t\t<empty/>\n\t</item>\n";
+		n++;
+	}
+	out << "</root>\n";
+	return out.str();
+}
+
+string generate_log(size_t size)
+{
+	static const char* levels[] = { "DEBUG", "INFO", "WARN", "ERROR" };
+	ostringstream out;
+	char line[128];
+	unsigned int n = 0;
+	while ((size_t)out.tellp() < size)
+	{
+		sprintf(line, "2013-%02u-%02u %02u:%02u:%02u.%03u [%s] ",
+				next_random(12) + 1, next_random(28) + 1, next_random(24),
+				next_random(60), next_random(60), next_random(1000),
+				levels[next_random(4)]);
+		out << line << "worker." << next_random(16) << ": " << random_word()
+			<< "=" << next_random(100000) << ", " << random_word() << " "
+			<< random_word() << " (request " << n << ")\n";
+		n++;
+	}
+	return out.str();
+}
+
+/* A name rule of many Unicode ranges, like the NameChar production of
+ * XML, it makes a big alphabet for the DFA. */
+wstring generate_wide_class()
+{
+	wstring start, rest;
+	for (wchar_t ch = 0x100; ch < 0x3000; ch += 0x20)
+	{
+		start += ch;
+		start += L'-';
+		start += (wchar_t)(ch + next_random(16) + 4);
+		wchar_t mid = (wchar_t)(ch + next_random(24));
+		rest += mid;
+		rest += L'-';
+		rest += (wchar_t)(mid + next_random(16) + 8);
+	}
+	return L"name: [a-zA-Z_" + start + L"][a-zA-Z0-9_\\-\\." + start + rest + L"]*\n"
+		L"space(i): [ \\t\\r\\n]+\n";
+}
+
+
+/* Measurement */
+
+struct Corpus
+{
+	string name;
+	string lexical;
+	bool lexical_file;
+	// Only for wchar_t, the lexical has characters beyond a byte.
+	wstring wide_lexical;
+	// Empty if only the compile time is measured.
+	string text;
+	// Pattern of regex_find() and regex_replace().
+	string regex;
+};
+
+struct Result
+{
+	string corpus;
+	string type;
+	string bench;
+	double seconds;
+	size_t bytes;
+	size_t tokens;
+};
+
+static vector<Result> results;
+static int repeat = 3;
+
+double now()
+{
+#ifdef __MSVC__
+	LARGE_INTEGER counter, frequency;
+	QueryPerformanceCounter(&counter);
+	QueryPerformanceFrequency(&frequency);
+	return (double)counter.QuadPart / frequency.QuadPart;
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+#endif
+}
+
+void add_result(const Corpus& corpus, const char* type, const char* bench,
+		double seconds, size_t bytes, size_t tokens)
+{
+	Result result;
+	result.corpus = corpus.name;
+	result.type = type;
+	result.bench = bench;
+	result.seconds = seconds;
+	result.bytes = bytes;
+	result.tokens = tokens;
+	results.push_back(result);
+	fprintf(stderr, "%s %s %s: %.6f s\n", corpus.name.c_str(), type, bench, seconds);
+}
+
+template <typename T>
+basic_string<T> widen(const string& str)
+{
+	return basic_string<T>(str.begin(), str.end());
+}
+
+template <typename T>
+typename lex::Lexical<T>::LexicalPtr create_lexical(const Corpus& corpus)
+{
+	if (corpus.lexical_file)
+		return lex::Lexical<T>::create_by_file(corpus.lexical);
+	else
+		return lex::Lexical<T>::create(widen<T>(corpus.lexical));
+}
+
+template <>
+lex::Lexical<wchar_t>::LexicalPtr create_lexical<wchar_t>(const Corpus& corpus)
+{
+	if (!corpus.wide_lexical.empty())
+		return lex::Lexical<wchar_t>::create(corpus.wide_lexical);
+	else if (corpus.lexical_file)
+		return lex::Lexical<wchar_t>::create_by_file(corpus.lexical);
+	else
+		return lex::Lexical<wchar_t>::create(widen<wchar_t>(corpus.lexical));
+}
+
+template <typename T>
+size_t scan(lex::Lexical<T>& lexical, const basic_string<T>& text)
+{
+	size_t tokens = 0;
+	lex::Token<T> token;
+	lexical.parse(text.c_str(), text.length());
+	while (lexical.fetch_next(token))
+		tokens++;
+	return tokens;
+}
+
+template <typename T>
+size_t find_all(const basic_string<T>& text, const lex::Regex<T>& regex)
+{
+	size_t found = 0;
+	basic_string<T> str;
+	size_t pos = lex::regex_find(text, regex, str);
+	while (pos != text.npos)
+	{
+		found++;
+		pos = lex::regex_find(text, regex, str, pos + (str.empty() ? 1 : str.length()));
+	}
+	return found;
+}
+
+/* Measure create() and create_by_bc(), return the created lexical. */
+template <typename T>
+typename lex::Lexical<T>::LexicalPtr bench_create(const Corpus& corpus,
+		const char* type)
+{
+	double best = 0;
+	typename lex::Lexical<T>::LexicalPtr lexical;
+	for (int i = 0; i < repeat; i++)
+	{
+		double start = now();
+		lexical = create_lexical<T>(corpus);
+		double seconds = now() - start;
+		if (i == 0 || seconds < best)
+			best = seconds;
+	}
+	add_result(corpus, type, "create", best, 0, 0);
+
+	string bc_file = "lexbench_" + corpus.name + "_" + type + ".bc";
+	lexical->save_bc(bc_file);
+	string bc;
+	{
+		ifstream in(bc_file.c_str(), ios::in | ios::binary);
+		ostringstream buf;
+		buf << in.rdbuf();
+		bc = buf.str();
+	}
+	remove(bc_file.c_str());
+	for (int i = 0; i < repeat; i++)
+	{
+		double start = now();
+		lex::Lexical<T>::create_by_bc(bc.data(), bc.length());
+		double seconds = now() - start;
+		if (i == 0 || seconds < best)
+			best = seconds;
+	}
+	add_result(corpus, type, "create_by_bc", best, bc.length(), 0);
+	return lexical;
+}
+
+template <typename T>
+void bench_type(const Corpus& corpus, const char* type)
+{
+	typename lex::Lexical<T>::LexicalPtr lexical = bench_create<T>(corpus, type);
+	if (corpus.text.empty())
+		return;
+	basic_string<T> text = widen<T>(corpus.text);
+	// Bytes of the source text, so the speed of every type is comparable.
+	size_t bytes = corpus.text.length();
+	double best = 0;
+
+	for (int best_match = 0; best_match < 2; best_match++)
+	{
+		lexical->best_match = (best_match != 0);
+		size_t tokens = 0;
+		for (int i = 0; i < repeat; i++)
+		{
+			double start = now();
+			tokens = scan(*lexical, text);
+			double seconds = now() - start;
+			if (i == 0 || seconds < best)
+				best = seconds;
+		}
+		add_result(corpus, type, best_match ? "scan_best_match" : "scan",
+				best, bytes, tokens);
+	}
+
+	lex::Regex<T> regex(widen<T>(corpus.regex));
+	size_t found = 0;
+	for (int i = 0; i < repeat; i++)
+	{
+		double start = now();
+		found = find_all(text, regex);
+		double seconds = now() - start;
+		if (i == 0 || seconds < best)
+			best = seconds;
+	}
+	add_result(corpus, type, "regex_find", best, bytes, found);
+
+	basic_string<T> rep = widen<T>("#");
+	for (int i = 0; i < repeat; i++)
+	{
+		double start = now();
+		lex::regex_replace(text, regex, rep);
+		double seconds = now() - start;
+		if (i == 0 || seconds < best)
+			best = seconds;
+	}
+	add_result(corpus, type, "regex_replace", best, bytes, found);
+}
+
+size_t scan_generated(const string& text, bool best_match)
+{
+	size_t tokens = 0;
+	const char* p = text.c_str();
+	const char* end = p + text.length();
+	unsigned int length;
+	for (;;)
+	{
+		unsigned int action = sax_scan(p, end, best_match, &length);
+		if (action == 0 && length == 0)
+			break;
+		p += length;
+		if (!sax_ignore[action])
+			tokens++;
+	}
+	return tokens;
+}
+
+/* Measure the generated scanner against the table scanner on the same text,
+ * both must find the same number of tokens. */
+void bench_generated(const Corpus& corpus)
+{
+	lex::Lexical<char>::LexicalPtr lexical = create_lexical<char>(corpus);
+	double best = 0;
+	for (int best_match = 0; best_match < 2; best_match++)
+	{
+		lexical->best_match = (best_match != 0);
+		size_t tokens = 0;
+		for (int i = 0; i < repeat; i++)
+		{
+			double start = now();
+			tokens = scan(*lexical, corpus.text);
+			double seconds = now() - start;
+			if (i == 0 || seconds < best)
+				best = seconds;
+		}
+		add_result(corpus, "char", best_match ? "scan_best_match" : "scan",
+				best, corpus.text.length(), tokens);
+
+		size_t generated = 0;
+		for (int i = 0; i < repeat; i++)
+		{
+			double start = now();
+			generated = scan_generated(corpus.text, best_match != 0);
+			double seconds = now() - start;
+			if (i == 0 || seconds < best)
+				best = seconds;
+		}
+		if (generated != tokens)
+			throw runtime_error("The generated scanner doesn't match the lexical.");
+		add_result(corpus, "char", best_match ? "generated_best_match" : "generated",
+				best, corpus.text.length(), generated);
+	}
+}
+
+string json_str(const string& str)
+{
+	string out = "\"";
+	for (size_t i = 0; i < str.length(); i++)
+	{
+		if (str[i] == '"' || str[i] == '\\')
+			out += '\\';
+		out += str[i];
+	}
+	return out + "\"";
+}
+
+void write_results(FILE* out, bool json)
+{
+	if (json)
+	{
+		fprintf(out, "{\n\t\"version\": 1,\n\t\"repeat\": %d,\n\t\"results\": [\n", repeat);
+		for (size_t i = 0; i < results.size(); i++)
+		{
+			const Result& r = results[i];
+			fprintf(out, "\t\t{\"corpus\": %s, \"type\": %s, \"bench\": %s, "
+					"\"seconds\": %.9f, \"bytes\": %lu, \"tokens\": %lu, "
+					"\"mb_per_second\": %.3f}%s\n",
+					json_str(r.corpus).c_str(), json_str(r.type).c_str(),
+					json_str(r.bench).c_str(), r.seconds, (unsigned long)r.bytes,
+					(unsigned long)r.tokens,
+					r.seconds > 0 ? r.bytes / r.seconds / 1048576 : 0.0,
+					i + 1 < results.size() ? "," : "");
+		}
+		fprintf(out, "\t]\n}\n");
+		return;
+	}
+	fprintf(out, "%-16s %-14s %-20s %14s %12s %10s\n",
+			"corpus", "type", "bench", "seconds", "tokens", "MB/s");
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		const Result& r = results[i];
+		fprintf(out, "%-16s %-14s %-20s %14.9f %12lu %10.2f\n",
+				r.corpus.c_str(), r.type.c_str(), r.bench.c_str(), r.seconds,
+				(unsigned long)r.tokens,
+				r.seconds > 0 ? r.bytes / r.seconds / 1048576 : 0.0);
+	}
+}
+
+
+int main (int argc, char *argv[])
+{
+	setlocale(LC_ALL, "");
+	size_t size = 4096 * 1024;
+	char *output = NULL;
+	bool json = false;
+	vector<Corpus> corpora;
+	const char* sax = NULL;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "-s") == 0 || strcmp(argv[i], "--size") == 0)
+		{
+			if (++i >= argc || atoi(argv[i]) <= 0)
+			{
+				show_error();
+				return 1;
+			}
+			size = (size_t)atoi(argv[i]) * 1024;
+		}
+		else if (strcmp(argv[i], "-r") == 0 || strcmp(argv[i], "--repeat") == 0)
+		{
+			if (++i >= argc || atoi(argv[i]) <= 0)
+			{
+				show_error();
+				return 1;
+			}
+			repeat = atoi(argv[i]);
+		}
+		else if (strcmp(argv[i], "-c") == 0 || strcmp(argv[i], "--corpus") == 0)
+		{
+			if (i + 2 >= argc)
+			{
+				show_error();
+				return 1;
+			}
+			Corpus corpus;
+			corpus.lexical = argv[++i];
+			corpus.lexical_file = true;
+			ifstream in(argv[++i], ios::in | ios::binary);
+			if (!in)
+			{
+				fprintf(stderr, "Cannot open file: %s\n", argv[i]);
+				return 2;
+			}
+			ostringstream buf;
+			buf << in.rdbuf();
+			corpus.text = buf.str();
+			const char* name = strrchr(argv[i], '/');
+			corpus.name = name ? name + 1 : argv[i];
+			corpus.regex = "[0-9]+";
+			corpora.push_back(corpus);
+		}
+		else if (strcmp(argv[i], "-x") == 0 || strcmp(argv[i], "--sax") == 0)
+		{
+			if (++i >= argc)
+			{
+				show_error();
+				return 1;
+			}
+			sax = argv[i];
+		}
+		else if (strcmp(argv[i], "-g") == 0 || strcmp(argv[i], "--grammar") == 0)
+		{
+			if (++i >= argc)
+			{
+				show_error();
+				return 1;
+			}
+			Corpus corpus;
+			corpus.lexical = argv[i];
+			corpus.lexical_file = true;
+			const char* name = strrchr(argv[i], '/');
+			corpus.name = name ? name + 1 : argv[i];
+			corpora.push_back(corpus);
+		}
+		else if (strcmp(argv[i], "-j") == 0 || strcmp(argv[i], "--json") == 0)
+			json = true;
+		else if (strcmp(argv[i], "-o") == 0 || strcmp(argv[i], "--out") == 0)
+		{
+			if (++i >= argc)
+			{
+				show_error();
+				return 1;
+			}
+			output = argv[i];
+		}
+		else if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+		{
+			show_usage();
+			return 0;
+		}
+		else
+		{
+			show_error();
+			return 1;
+		}
+	}
+
+	Corpus corpus;
+	corpus.lexical_file = false;
+	corpus.name = "c";
+	corpus.lexical = c_lexical;
+	corpus.text = generate_c(size);
+	corpus.regex = "0x[0-9a-f]+";
+	corpora.insert(corpora.begin(), corpus);
+	corpus.name = "xml";
+	corpus.lexical = xml_lexical;
+	corpus.text = generate_xml(size);
+	corpus.regex = "size=\"[0-9]+\"";
+	corpora.insert(corpora.begin() + 1, corpus);
+	corpus.name = "log";
+	corpus.lexical = log_lexical;
+	corpus.text = generate_log(size);
+	corpus.regex = "\\[ERROR\\]";
+	corpora.insert(corpora.begin() + 2, corpus);
+	corpus.name = "wide_class";
+	corpus.lexical.clear();
+	corpus.wide_lexical = generate_wide_class();
+	corpus.text.clear();
+	corpora.insert(corpora.begin() + 3, corpus);
+
+	try
+	{
+		for (size_t i = 0; i < corpora.size(); i++)
+		{
+			if (corpora[i].wide_lexical.empty())
+			{
+				bench_type<char>(corpora[i], "char");
+				bench_type<unsigned char>(corpora[i], "unsigned_char");
+			}
+			bench_type<wchar_t>(corpora[i], "wchar_t");
+		}
+		if (sax)
+		{
+			corpus.name = "sax";
+			corpus.lexical = sax;
+			corpus.lexical_file = true;
+			corpus.wide_lexical.clear();
+			corpus.text = corpora[1].text;
+			bench_generated(corpus);
+		}
+	}
+	catch (const std::exception& e)
+	{
+		fprintf(stderr, "%s\n", e.what());
+		return 2;
+	}
+
+	FILE* out = stdout;
+	if (output)
+	{
+		out = fopen(output, "w");
+		if (!out)
+		{
+			fprintf(stderr, "Cannot open file: %s\n", output);
+			return 2;
+		}
+	}
+	write_results(out, json);
+	if (output)
+		fclose(out);
+	return 0;
+}
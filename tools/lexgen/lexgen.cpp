@@ -55,6 +55,14 @@ void show_usage()
 			"                     in current working directory.\n"
 			"  -w, --wchar        Use wchar_t as internal character type.\n"
 			"  -u, --unsigned     Use unsigned char as internal character type.\n"
+			"  -8, --utf8         Use char as internal character type and scan UTF-8\n"
+			"                     text, the input file can use any Unicode characters.\n"
+			"  -c, --compress     Compress the transit table, it is useful for the\n"
+			"                     big lexical that has many states.\n"
+			"  -p, --cpp          Output a C++ source of the scanner instead of the\n"
+			"                     binary lexical, default output is \"<input name>.cpp\".\n"
+			"  -n, --name <NAME>  Scanner name of the C++ source, the function is\n"
+			"                     \"<NAME>_scan\", default is the input name.\n"
 			"  -h, --help         Show this usage information and leave.\n\n");
 }
 
@@ -64,7 +72,10 @@ int main (int argc, char *argv[])
 	setlocale(LC_ALL, "");
 	char *input = NULL;
 	char *output = NULL;
+	char *name = NULL;
 	int type = 0;
+	bool compress = false;
+	bool cpp = false;
 	for (int i = 1; i < argc; ++i)
 	{
 		if (*(argv[i]) != '-')
@@ -89,6 +100,28 @@ int main (int argc, char *argv[])
 		{
 			type = 1;
 		}
+		else if (strcmp(argv[i], "--utf8") == 0 || strcmp(argv[i], "-8") == 0)
+		{
+			type = 3;
+		}
+		else if (strcmp(argv[i], "--compress") == 0 || strcmp(argv[i], "-c") == 0)
+		{
+			compress = true;
+		}
+		else if (strcmp(argv[i], "--cpp") == 0 || strcmp(argv[i], "-p") == 0)
+		{
+			cpp = true;
+		}
+		else if (strcmp(argv[i], "--name") == 0 || strcmp(argv[i], "-n") == 0)
+		{
+			if (i >= argc - 2 || *(argv[i + 1]) == '-')
+			{
+				show_error();
+				return -1;
+			}
+			name = argv[i + 1];
+			++i;
+		}
 		else if (strcmp(argv[i], "--out") == 0 || strcmp(argv[i], "-o") == 0)
 		{
 			if (i >= argc - 2 || *(argv[i + 1]) == '-')
@@ -110,38 +143,78 @@ int main (int argc, char *argv[])
 		fprintf(stderr, "Generate failed: pathname too lang.\n");
 		return -1;
 	}
+	string base = input;
+	if (base.rfind('.') != base.npos)
+		base = base.substr(0, base.rfind('.'));
 	string out;
 	if (output == NULL)
+		out = base + (cpp ? ".cpp" : ".bc");
+	else
+		out = output;
+	string scanner;
+	if (name == NULL)
 	{
-		out = input;
-		if (out.rfind('.') != out.npos)
-			out = out.substr(0, out.rfind('.'));
-		out += ".bc";
+		string::size_type pos = base.find_last_of("/\\");
+		scanner = (pos == base.npos) ? base : base.substr(pos + 1);
+		for (string::size_type i = 0; i < scanner.length(); i++)
+		{
+			if (!isalnum((unsigned char)scanner[i]))
+				scanner[i] = '_';
+		}
 	}
 	else
-		out = output;
+		scanner = name;
 
 
 	try
 	{
-		cout << "Generate binary lexical file ..." << endl;
-		if (type == 2)
+		if (cpp)
+			cout << "Generate C++ scanner ..." << endl;
+		else
+			cout << "Generate binary lexical file ..." << endl;
+		if (type == 3)
+		{
+			lex::Lexical<char>::LexicalPtr lex =
+					lex::Lexical<char>::create_utf8_by_file(input);
+			if (compress)
+				lex->compress();
+			if (cpp)
+				lex->save_cpp(out, scanner);
+			else
+				lex->save_bc(out);
+		}
+		else if (type == 2)
 		{
 			lex::Lexical<wchar_t>::LexicalPtr lex =
 					lex::Lexical<wchar_t>::create_by_file(input);
-			lex->save_bc(out);
+			if (compress)
+				lex->compress();
+			if (cpp)
+				lex->save_cpp(out, scanner);
+			else
+				lex->save_bc(out);
 		}
 		else if (type == 1)
 		{
 			lex::Lexical<unsigned char>::LexicalPtr lex =
 					lex::Lexical<unsigned char>::create_by_file(input);
-			lex->save_bc(out);
+			if (compress)
+				lex->compress();
+			if (cpp)
+				lex->save_cpp(out, scanner);
+			else
+				lex->save_bc(out);
 		}
 		else
 		{
 			lex::Lexical<char>::LexicalPtr lex =
 					lex::Lexical<char>::create_by_file(input);
-			lex->save_bc(out);
+			if (compress)
+				lex->compress();
+			if (cpp)
+				lex->save_cpp(out, scanner);
+			else
+				lex->save_bc(out);
 		}
 		cout << "Succeeded!!" << endl;
 	}